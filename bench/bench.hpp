@@ -0,0 +1,216 @@
+#pragma once
+
+#include <imgui.h>
+
+#include <algorithm> // min
+#include <chrono>
+#include <stdio.h>  // printf
+#include <stdlib.h> // malloc, free, atoi
+#include <string.h> // strcmp
+#include <vector>
+
+// Minimal harness shared by the benchmarks under bench/.
+// Every executable accepts
+//   --json          print the results as one JSON object
+//   --repeat N      best of N runs per case (default 5)
+//   --scale F       multiply the iteration counts by F (default 1)
+
+namespace ec_bench {
+
+  /// keeps value alive without the compiler seeing through it
+  template <class T>
+  inline void DoNotOptimize(const T& value) {
+#if defined(_MSC_VER)
+    static const void* volatile sink;
+    sink = &value;
+#else
+    asm volatile("" : : "r,m"(value) : "memory");
+#endif
+  }
+
+  inline double NowNs() {
+    using namespace std::chrono;
+    return static_cast<double>(
+      duration_cast<nanoseconds>(steady_clock::now().time_since_epoch())
+        .count());
+  }
+
+  /// one named metric of a case
+  struct Metric {
+    const char* name;
+    double value;
+  };
+
+  /// Collects the results of one executable and prints them at exit.
+  class Reporter {
+  public:
+    Reporter(const char* bench, int argc, char** argv)
+      : m_bench(bench)
+      , m_json(false)
+      , m_repeat(5)
+      , m_scale(1.0) {
+      for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--json") == 0)
+          m_json = true;
+        else if (strcmp(argv[i], "--repeat") == 0 && i + 1 < argc)
+          m_repeat = std::max(1, atoi(argv[++i]));
+        else if (strcmp(argv[i], "--scale") == 0 && i + 1 < argc)
+          m_scale = atof(argv[++i]);
+      }
+    }
+    ~Reporter() {
+      Print();
+    }
+
+    Reporter(const Reporter&) = delete;
+    Reporter& operator=(const Reporter&) = delete;
+
+    int Repeat() const {
+      return m_repeat;
+    }
+    /// n scaled by --scale, at least 1
+    int Iterations(int n) const {
+      return std::max(1, static_cast<int>(n * m_scale));
+    }
+
+    /// Best time of Repeat() runs of f(), divided by ops.
+    template <class F>
+    double TimeNsPerOp(int ops, F&& f) const {
+      double best = 0;
+      for (int r = 0; r < m_repeat; ++r) {
+        const double t0 = NowNs();
+        f();
+        const double t = NowNs() - t0;
+        best           = r == 0 ? t : std::min(best, t);
+      }
+      return best / ops;
+    }
+
+    void Add(const char* name, std::initializer_list<Metric> metrics) {
+      Case c;
+      c.name = name;
+      c.metrics.assign(metrics.begin(), metrics.end());
+      m_cases.push_back(c);
+    }
+
+  private:
+    struct Case {
+      const char* name;
+      std::vector<Metric> metrics;
+    };
+
+    void Print() const {
+      if (m_json) {
+        printf("{\"bench\": \"%s\", \"cases\": [", m_bench);
+        for (size_t i = 0; i < m_cases.size(); ++i) {
+          printf("%s\n  {\"name\": \"%s\"", i ? "," : "", m_cases[i].name);
+          for (const Metric& m : m_cases[i].metrics)
+            printf(", \"%s\": %.6g", m.name, m.value);
+          printf("}");
+        }
+        printf("\n]}\n");
+        return;
+      }
+      printf("%s\n", m_bench);
+      for (const Case& c : m_cases) {
+        printf("  %-40s", c.name);
+        for (const Metric& m : c.metrics)
+          printf("  %s=%.6g", m.name, m.value);
+        printf("\n");
+      }
+    }
+
+    const char* m_bench;
+    bool m_json;
+    int m_repeat;
+    double m_scale;
+    std::vector<Case> m_cases;
+  };
+
+  // ----------------------------------------
+  // headless ImGui
+
+  /// number of MemAlloc() calls since the context was created
+  inline ImU64& AllocCount() {
+    static ImU64 count = 0;
+    return count;
+  }
+
+  inline void* CountingAlloc(size_t size, void*) {
+    ++AllocCount();
+    return malloc(size);
+  }
+  inline void CountingFree(void* ptr, void*) {
+    free(ptr);
+  }
+
+  /// per-frame averages of Headless::Run()
+  struct FrameStats {
+    double ns;
+    double vtx;
+    double idx;
+    double allocs;
+  };
+
+  /// An ImGui context with a fixed display size and no renderer: frames
+  /// are built and tessellated, and the draw data is dropped.
+  class Headless {
+  public:
+    explicit Headless(ImVec2 display_size = ImVec2(1920, 1080)) {
+      ImGui::SetAllocatorFunctions(CountingAlloc, CountingFree);
+      m_context   = ImGui::CreateContext();
+      ImGuiIO& io = ImGui::GetIO();
+      io.DisplaySize = display_size;
+      io.DeltaTime   = 1.0f / 60.0f;
+      io.IniFilename = NULL;
+      unsigned char* pixels;
+      int width, height;
+      io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+      io.Fonts->TexID = reinterpret_cast<ImTextureID>(1);
+    }
+    ~Headless() {
+      ImGui::DestroyContext(m_context);
+    }
+
+    Headless(const Headless&) = delete;
+    Headless& operator=(const Headless&) = delete;
+
+    /// Runs warmup frames of build(), then the best average of
+    /// reporter.Repeat() runs of frames frames.
+    template <class F>
+    FrameStats Run(const Reporter& reporter, int frames, F&& build) {
+      for (int i = 0; i < 3; ++i)
+        Frame(build);
+      FrameStats best = {0, 0, 0, 0};
+      for (int r = 0; r < reporter.Repeat(); ++r) {
+        FrameStats s       = {0, 0, 0, 0};
+        const ImU64 allocs = AllocCount();
+        const double t0    = NowNs();
+        for (int i = 0; i < frames; ++i) {
+          const ImDrawData* draw = Frame(build);
+          s.vtx += draw->TotalVtxCount;
+          s.idx += draw->TotalIdxCount;
+        }
+        s.ns     = (NowNs() - t0) / frames;
+        s.vtx    = s.vtx / frames;
+        s.idx    = s.idx / frames;
+        s.allocs = static_cast<double>(AllocCount() - allocs) / frames;
+        if (r == 0 || s.ns < best.ns)
+          best = s;
+      }
+      return best;
+    }
+
+  private:
+    template <class F>
+    const ImDrawData* Frame(F& build) {
+      ImGui::NewFrame();
+      build();
+      ImGui::Render();
+      return ImGui::GetDrawData();
+    }
+
+    ImGuiContext* m_context;
+  };
+
+} // namespace ec_bench
@@ -0,0 +1,67 @@
+// GetColorU32(Col) against the cached lookups of ColorCache.hpp.
+
+#include "bench.hpp"
+
+#include <imgui_EnumClass/ColorCache.hpp>
+
+int main(int argc, char** argv) {
+  ec_bench::Reporter reporter("color_cache", argc, argv);
+  ec_bench::Headless headless;
+  const int n = reporter.Iterations(1 << 20);
+
+  // the draw code pattern: a few colors, looked up over and over
+  const ImGui::Col cols[4] = {
+    ImGui::Col::Text, ImGui::Col::Border, ImGui::Col::FrameBg,
+    ImGui::Col::Button};
+
+  reporter.Add(
+    "GetColorU32",
+    {{"ns_per_op", reporter.TimeNsPerOp(n, [&] {
+        for (int i = 0; i < n; ++i)
+          ec_bench::DoNotOptimize(ImGui::GetColorU32(cols[i & 3]));
+      })}});
+  reporter.Add(
+    "GetColorU32 alpha_mul",
+    {{"ns_per_op", reporter.TimeNsPerOp(n, [&] {
+        for (int i = 0; i < n; ++i)
+          ec_bench::DoNotOptimize(ImGui::GetColorU32(cols[i & 3], 0.5f));
+      })}});
+  reporter.Add(
+    "GetColorU32Cached",
+    {{"ns_per_op", reporter.TimeNsPerOp(n, [&] {
+        for (int i = 0; i < n; ++i)
+          ec_bench::DoNotOptimize(ImGui::GetColorU32Cached(cols[i & 3]));
+      })}});
+  reporter.Add(
+    "GetColorU32Cached alpha_mul",
+    {{"ns_per_op", reporter.TimeNsPerOp(n, [&] {
+        for (int i = 0; i < n; ++i)
+          ec_bench::DoNotOptimize(
+            ImGui::GetColorU32Cached(cols[i & 3], 0.5f));
+      })}});
+
+  ImGui::ColorU32Cache cache;
+  reporter.Add(
+    "ColorU32Cache::Get",
+    {{"ns_per_op", reporter.TimeNsPerOp(n, [&] {
+        for (int i = 0; i < n; ++i)
+          ec_bench::DoNotOptimize(cache.Get(cols[i & 3]));
+      })}});
+
+  // a push every 64 lookups, popped 32 lookups later; each one drops the
+  // cache through the color stack depth
+  reporter.Add(
+    "GetColorU32Cached push/pop",
+    {{"ns_per_op", reporter.TimeNsPerOp(n, [&] {
+        for (int i = 0; i < n; ++i) {
+          if ((i & 63) == 0)
+            ImGui::PushStyleColor(ImGui::Col::Text, IM_COL32(255, 0, 0, 255));
+          else if ((i & 63) == 32)
+            ImGui::PopStyleColor();
+          ec_bench::DoNotOptimize(ImGui::GetColorU32Cached(cols[i & 3]));
+        }
+        if (n != 0 && ((n - 1) & 63) < 32)
+          ImGui::PopStyleColor();
+      })}});
+  return 0;
+}
@@ -0,0 +1,116 @@
+// Enqueue throughput of UiCommandQueue with 1 and 16 producer threads,
+// drained by a consumer thread calling Pop() or by headless frames calling
+// Execute().
+
+#include "bench.hpp"
+
+#include <imgui_EnumClass/CommandQueue.hpp>
+
+#include <atomic>
+#include <memory> // unique_ptr
+#include <thread>
+#include <vector>
+
+namespace {
+  using ImGui::UiCommand;
+  using ImGui::UiCommandOp;
+  using Queue = ImGui::UiCommandQueue<>;
+
+  /// what a simulation thread would send: window moves and cursor changes
+  void produce(
+    Queue& queue,
+    int count,
+    int producer,
+    const std::atomic<bool>& go,
+    std::atomic<ImU64>& full) {
+    while (!go.load(std::memory_order_acquire))
+      std::this_thread::yield();
+    ImU64 retries = 0;
+    for (int i = 0; i < count; ++i) {
+      UiCommand cmd;
+      if (i & 7) {
+        const float x = static_cast<float>(producer * 40 + (i & 31));
+        cmd           = UiCommand::Make(UiCommandOp::SetNextWindowPos);
+        cmd.value     = ImVec4(x, 10.0f, 0.0f, 0.0f);
+      } else {
+        cmd        = UiCommand::Make(UiCommandOp::SetMouseCursor);
+        cmd.cursor = ImGui::MouseCursor::Hand;
+      }
+      while (!queue.Push(cmd)) {
+        ++retries;
+        std::this_thread::yield();
+      }
+    }
+    full.fetch_add(retries, std::memory_order_relaxed);
+  }
+
+  /// Runs producers threads with per_producer commands each while drain()
+  /// empties the queue on the calling thread, returning the number of
+  /// commands it took, until all are consumed. Adds the enqueue rate and
+  /// the pushes retried because the queue was full.
+  template <class Drain>
+  void bench_queue(
+    ec_bench::Reporter& reporter,
+    const char* name,
+    int producers,
+    int per_producer,
+    Drain&& drain) {
+    std::unique_ptr<Queue> queue(new Queue);
+    const int total = producers * per_producer;
+    std::atomic<ImU64> full {0};
+
+    const double ns = reporter.TimeNsPerOp(total, [&] {
+      std::atomic<bool> go {false};
+      std::vector<std::thread> threads;
+      for (int p = 0; p < producers; ++p)
+        threads.emplace_back(
+          produce, std::ref(*queue), per_producer, p, std::cref(go),
+          std::ref(full));
+      go.store(true, std::memory_order_release);
+      int consumed = 0;
+      while (consumed < total)
+        consumed += drain(*queue);
+      for (std::thread& t : threads)
+        t.join();
+    });
+    reporter.Add(
+      name,
+      {{"enqueues_per_s", 1e9 / ns},
+       {"ns_per_enqueue", ns},
+       {"full_retries_per_enqueue",
+        static_cast<double>(full.load()) / total / reporter.Repeat()}});
+  }
+
+  /// Pop() until empty
+  int drain_pop(Queue& queue) {
+    UiCommand cmd;
+    int n = 0;
+    while (queue.Pop(cmd)) {
+      ec_bench::DoNotOptimize(cmd);
+      ++n;
+    }
+    if (n == 0)
+      std::this_thread::yield();
+    return n;
+  }
+} // namespace
+
+int main(int argc, char** argv) {
+  ec_bench::Reporter reporter("command_queue", argc, argv);
+  ec_bench::Headless headless;
+  const int per_producer = reporter.Iterations(200000);
+
+  bench_queue(reporter, "1 producer, Pop", 1, per_producer * 4, drain_pop);
+  bench_queue(reporter, "16 producers, Pop", 16, per_producer, drain_pop);
+
+  // the UI thread only drains once per frame, so the queue fills up
+  bench_queue(
+    reporter, "16 producers, Execute per frame", 16, per_producer / 4,
+    [](Queue& queue) {
+      ImGui::NewFrame();
+      const int n = queue.Execute();
+      ImGui::Render();
+      return n;
+    });
+  return 0;
+}
@@ -0,0 +1,16 @@
+// The umbrella header, as included by most translation units.
+#include <imgui_EnumClass.hpp>
+
+bool fixture_all(ImDrawList* draw_list) {
+  ImGui::SetNextWindowSize(ImVec2(300, 200), ImGui::Cond::FirstUseEver);
+  if (!ImGui::Begin("window", NULL, ImGui::WindowFlags::NoMove))
+    return false;
+  ImGui::PushStyleColor(ImGui::Col::Text, IM_COL32(255, 0, 0, 255));
+  ImGui::AddRect(
+    draw_list, ImVec2(0, 0), ImVec2(10, 10),
+    ImGui::GetColorU32(ImGui::Col::Border), 4.0f,
+    ImGui::DrawCornerFlags::Top);
+  ImGui::PopStyleColor();
+  ImGui::End();
+  return true;
+}
@@ -0,0 +1,15 @@
+// Cost of imgui.h alone, the floor of every other fixture.
+#include <imgui.h>
+
+bool fixture_baseline(ImDrawList* draw_list) {
+  ImGui::SetNextWindowSize(ImVec2(300, 200), ImGuiCond_FirstUseEver);
+  if (!ImGui::Begin("window", NULL, ImGuiWindowFlags_NoMove))
+    return false;
+  ImGui::PushStyleColor(ImGuiCol_Text, IM_COL32(255, 0, 0, 255));
+  draw_list->AddRect(
+    ImVec2(0, 0), ImVec2(10, 10), ImGui::GetColorU32(ImGuiCol_Border), 4.0f,
+    ImDrawCornerFlags_Top);
+  ImGui::PopStyleColor();
+  ImGui::End();
+  return true;
+}
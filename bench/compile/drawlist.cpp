@@ -0,0 +1,10 @@
+#include <imgui_EnumClass/DrawList.hpp>
+
+void fixture_drawlist(ImDrawList* draw_list, ImU32 col) {
+  using ImGui::DrawCornerFlags;
+  ImGui::AddRect(
+    draw_list, ImVec2(0, 0), ImVec2(10, 10), col, 4.0f,
+    DrawCornerFlags::TopLeft | DrawCornerFlags::BotRight);
+  ImGui::AddRectFilled(
+    draw_list, ImVec2(0, 0), ImVec2(10, 10), col, 4.0f, DrawCornerFlags::Top);
+}
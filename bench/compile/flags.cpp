@@ -0,0 +1,16 @@
+#include <imgui_EnumClass/Flags.hpp>
+
+namespace {
+  enum class Fixture : int { A = 1, B = 2, C = 4 };
+}
+template <>
+struct ImGui::ec_detail::is_enum_flag<Fixture> : std::true_type {};
+
+int fixture_flags(int bits) {
+  using namespace ImGui;
+  Fixture f = static_cast<Fixture>(bits);
+  f |= Fixture::A | Fixture::B;
+  f &= ~Fixture::C;
+  f ^= Fixture::B;
+  return static_cast<int>(f) + (!f ? 1 : 0);
+}
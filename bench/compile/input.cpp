@@ -0,0 +1,12 @@
+#include <imgui_EnumClass/Input.hpp>
+
+bool fixture_input(int* count, float* position, char* buf, size_t size) {
+  bool changed = ImGui::DragScalar("count", count, 1.0f, 0, 100);
+  changed |= ImGui::SliderScalarN("position", position, 3, 0.0f, 1.0f);
+  changed |= ImGui::InputText(
+    "name", buf, size,
+    ImGui::InputTextFlags::AutoSelectAll |
+      ImGui::InputTextFlags::CharsNoBlank);
+  ImGui::SetMouseCursor(ImGui::MouseCursor::TextInput);
+  return changed || ImGui::IsKeyPressed(ImGui::GetKeyIndex(ImGui::Key::Enter));
+}
@@ -0,0 +1,109 @@
+# Compile-time cost of each fixture: front-end time, template instantiations
+# and object size. Run through the imgui_enum_class_compile_report target, or
+#   cmake -DCONFIG=<build>/bench/compile_config.cmake -P report.cmake
+# CONFIG sets COMPILER, COMPILER_ID, FLAGS, INCLUDE_DIRS, SOURCE_DIR,
+# FIXTURES, WORK_DIR, OUTPUT and REPEAT.
+#
+# Clang runs with -ftime-trace: front-end time and instantiation counts come
+# from the "Total Frontend" and "Total Instantiate*" events of the trace.
+# GCC runs with -ftime-report, which has no instantiation count, so only the
+# time spent instantiating templates is reported.
+
+cmake_minimum_required(VERSION 3.19) # string(JSON)
+include(${CONFIG})
+
+set(include_flags)
+foreach(dir IN LISTS INCLUDE_DIRS)
+  list(APPEND include_flags "-I${dir}")
+endforeach()
+file(MAKE_DIRECTORY ${WORK_DIR})
+
+# wall time in ms of the "<phase> : usr sys wall GGC" line of -ftime-report
+function(gcc_phase_ms report phase out)
+  set(ms 0)
+  string(REGEX MATCH "${phase} *:[^\n]*" line "${report}")
+  string(REGEX MATCHALL "[0-9]+\\.[0-9]+" times "${line}")
+  list(LENGTH times n)
+  if(n GREATER_EQUAL 3)
+    list(GET times 2 wall) # usr, sys, wall
+    string(REGEX MATCH "^([0-9]+)\\.([0-9][0-9])" wall "${wall}")
+    math(EXPR ms "${CMAKE_MATCH_1} * 1000 + ${CMAKE_MATCH_2} * 10")
+  endif()
+  set(${out} ${ms} PARENT_SCOPE)
+endfunction()
+
+# duration in ms and count of the "Total <name>" event of a Clang trace
+function(clang_total json name out_ms out_count)
+  set(ms 0)
+  set(count 0)
+  string(JSON n LENGTH "${json}" traceEvents)
+  math(EXPR last "${n} - 1")
+  foreach(i RANGE ${last})
+    string(JSON event_name GET "${json}" traceEvents ${i} name)
+    if(event_name STREQUAL "Total ${name}")
+      string(JSON us GET "${json}" traceEvents ${i} dur)
+      string(JSON count GET "${json}" traceEvents ${i} args count)
+      math(EXPR ms "${us} / 1000")
+      break()
+    endif()
+  endforeach()
+  set(${out_ms} ${ms} PARENT_SCOPE)
+  set(${out_count} ${count} PARENT_SCOPE)
+endfunction()
+
+set(cases)
+foreach(fixture IN LISTS FIXTURES)
+  set(object ${WORK_DIR}/${fixture}.o)
+  set(command ${COMPILER} ${FLAGS} ${include_flags} -O2 -c
+    ${SOURCE_DIR}/${fixture}.cpp -o ${object})
+  if(COMPILER_ID MATCHES "Clang")
+    list(APPEND command -ftime-trace)
+  else()
+    list(APPEND command -ftime-report)
+  endif()
+
+  # best of REPEAT runs
+  set(frontend -1)
+  foreach(run RANGE 1 ${REPEAT})
+    execute_process(
+      COMMAND ${command} RESULT_VARIABLE result ERROR_VARIABLE report)
+    if(NOT result EQUAL 0)
+      message(FATAL_ERROR "${fixture}.cpp failed to compile:\n${report}")
+    endif()
+
+    if(COMPILER_ID MATCHES "Clang")
+      file(READ ${WORK_DIR}/${fixture}.json json)
+      clang_total("${json}" Frontend run_frontend ignored)
+      clang_total("${json}" InstantiateFunction function_ms functions)
+      clang_total("${json}" InstantiateClass class_ms classes)
+      math(EXPR instantiations "${functions} + ${classes}")
+      math(EXPR run_template "${function_ms} + ${class_ms}")
+    else()
+      gcc_phase_ms("${report}" "phase parsing" parsing)
+      gcc_phase_ms("${report}" "phase lang. deferred" deferred)
+      gcc_phase_ms("${report}" "template instantiation" run_template)
+      math(EXPR run_frontend "${parsing} + ${deferred}")
+      set(instantiations null)
+    endif()
+    if(frontend LESS 0 OR run_frontend LESS frontend)
+      set(frontend ${run_frontend})
+      set(template ${run_template})
+    endif()
+  endforeach()
+  file(SIZE ${object} object_bytes)
+
+  message(
+    "  ${fixture}: frontend_ms=${frontend} instantiations=${instantiations}"
+    " template_ms=${template} object_bytes=${object_bytes}")
+  string(CONCAT case
+    "{\"name\": \"${fixture}\", \"frontend_ms\": ${frontend}, "
+    "\"instantiations\": ${instantiations}, \"template_ms\": ${template}, "
+    "\"object_bytes\": ${object_bytes}}")
+  list(APPEND cases "${case}")
+endforeach()
+
+list(JOIN cases ",\n  " cases)
+file(WRITE ${OUTPUT}
+  "{\"bench\": \"compile\", \"compiler\": \"${COMPILER_ID}\", \"cases\": [\n"
+  "  ${cases}\n]}\n")
+message("written ${OUTPUT}")
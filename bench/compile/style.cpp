@@ -0,0 +1,11 @@
+#include <imgui_EnumClass/Style.hpp>
+
+ImU32 fixture_style() {
+  ImGui::PushStyleColor(ImGui::Col::Text, IM_COL32(255, 0, 0, 255));
+  ImGui::PushStyleVar(ImGui::StyleVar::FramePadding, ImVec2(4, 2));
+  ImGui::PushStyleVar(ImGui::StyleVar::Alpha, 0.5f);
+  const ImU32 col = ImGui::GetColorU32(ImGui::Col::Border);
+  ImGui::PopStyleVar(2);
+  ImGui::PopStyleColor();
+  return col;
+}
@@ -0,0 +1,19 @@
+#include <imgui_EnumClass/Widgets.hpp>
+
+bool fixture_widgets(float* color, int* selected) {
+  using ImGui::TreeNodeFlags;
+  bool changed = ImGui::ColorEdit4(
+    "color", color,
+    ImGui::ColorEditFlags::NoInputs | ImGui::ColorEditFlags::AlphaBar);
+  if (ImGui::TreeNodeEx("node", TreeNodeFlags::OpenOnArrow)) {
+    for (int i = 0; i < 4; ++i)
+      if (ImGui::Selectable("item", *selected == i))
+        *selected = i;
+    ImGui::TreePop();
+  }
+  if (ImGui::BeginCombo("combo", "preview", ImGui::ComboFlags::HeightSmall)) {
+    changed = true;
+    ImGui::EndCombo();
+  }
+  return changed || ImGui::ArrowButton("arrow", ImGui::Dir::Left);
+}
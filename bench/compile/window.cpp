@@ -0,0 +1,15 @@
+#include <imgui_EnumClass/Window.hpp>
+
+bool fixture_window() {
+  using ImGui::WindowFlags;
+  ImGui::SetNextWindowSize(ImVec2(300, 200), ImGui::Cond::FirstUseEver);
+  if (!ImGui::Begin("window", NULL, WindowFlags::NoMove | WindowFlags::NoResize))
+    return false;
+  ImGui::BeginChild("child", ImVec2(0, 0), true, WindowFlags::NoScrollbar);
+  const bool hovered = ImGui::IsWindowHovered(
+    ImGui::HoveredFlags::ChildWindows |
+    ImGui::HoveredFlags::AllowWhenBlockedByPopup);
+  ImGui::EndChild();
+  ImGui::End();
+  return hovered && ImGui::IsWindowFocused(ImGui::FocusedFlags::RootWindow);
+}
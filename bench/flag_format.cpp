@@ -0,0 +1,115 @@
+// FormatFlags/ParseFlags throughput, against a linear scan of the names.
+
+#include "bench.hpp"
+
+#include <imgui_EnumClass.hpp>
+#include <imgui_EnumClass/FlagFormat.hpp>
+
+#include <string.h> // strcpy, strlen, strncmp
+
+namespace {
+  using ImGui::WindowFlags;
+
+  const WindowFlags samples[8] = {
+    WindowFlags::None,
+    WindowFlags::NoMove,
+    WindowFlags::NoTitleBar | WindowFlags::NoResize,
+    WindowFlags::NoDecoration,
+    WindowFlags::NoDecoration | WindowFlags::NoMove | WindowFlags::MenuBar,
+    WindowFlags::AlwaysAutoReize | WindowFlags::NoSavedSettings,
+    WindowFlags::NoInputs | WindowFlags::NoBackground,
+    WindowFlags::HorizontalScrollbar | WindowFlags::NoFocusOnAppearing |
+      WindowFlags::NoBringToFrontOnFocus | WindowFlags::NoNav,
+  };
+
+  /// what formatting without the tables looks like: one pass over every
+  /// name, composites ignored
+  size_t format_linear(WindowFlags flags, char* buf) {
+    const auto& values = ImGui::EnumValues<WindowFlags>();
+    const auto& names  = ImGui::EnumNames<WindowFlags>();
+    const int bits     = static_cast<int>(flags);
+    char* out          = buf;
+    for (size_t i = 0; i < values.size(); ++i) {
+      const int v = static_cast<int>(values[i]);
+      if (v == 0 || (v & (v - 1)) != 0 || (bits & v) != v)
+        continue;
+      if (out != buf)
+        *out++ = '|';
+      strcpy(out, names[i]);
+      out += strlen(names[i]);
+    }
+    *out = '\0';
+    return static_cast<size_t>(out - buf);
+  }
+
+  /// parsing by comparing each token with every name
+  int parse_linear(const char* str) {
+    const auto& values = ImGui::EnumValues<WindowFlags>();
+    const auto& names  = ImGui::EnumNames<WindowFlags>();
+    int bits           = 0;
+    while (*str) {
+      const char* end = strchr(str, '|');
+      const size_t n  = end ? static_cast<size_t>(end - str) : strlen(str);
+      for (size_t i = 0; i < values.size(); ++i)
+        if (strlen(names[i]) == n && strncmp(names[i], str, n) == 0)
+          bits |= static_cast<int>(values[i]);
+      str += end ? n + 1 : n;
+    }
+    return bits;
+  }
+} // namespace
+
+int main(int argc, char** argv) {
+  ec_bench::Reporter reporter("flag_format", argc, argv);
+  const int n = reporter.Iterations(1 << 18);
+
+  char texts[8][256];
+  size_t total = 0;
+  for (int i = 0; i < 8; ++i)
+    total += ImGui::FormatFlags(samples[i], texts[i], sizeof(texts[i]));
+  const double bytes_per_op = static_cast<double>(total) / 8;
+
+  char buf[256];
+  double ns = reporter.TimeNsPerOp(n, [&] {
+    for (int i = 0; i < n; ++i)
+      ec_bench::DoNotOptimize(
+        ImGui::FormatFlags(samples[i & 7], buf, sizeof(buf)));
+  });
+  reporter.Add(
+    "FormatFlags", {{"ns_per_op", ns}, {"mb_per_s", bytes_per_op * 1e3 / ns}});
+
+  ImGuiTextBuffer text;
+  ns = reporter.TimeNsPerOp(n, [&] {
+    for (int i = 0; i < n; ++i) {
+      text.clear();
+      ImGui::FormatFlags(samples[i & 7], text);
+      ec_bench::DoNotOptimize(text.begin());
+    }
+  });
+  reporter.Add(
+    "FormatFlags ImGuiTextBuffer",
+    {{"ns_per_op", ns}, {"mb_per_s", bytes_per_op * 1e3 / ns}});
+
+  ns = reporter.TimeNsPerOp(n, [&] {
+    for (int i = 0; i < n; ++i)
+      ec_bench::DoNotOptimize(format_linear(samples[i & 7], buf));
+  });
+  reporter.Add(
+    "linear format",
+    {{"ns_per_op", ns}, {"mb_per_s", bytes_per_op * 1e3 / ns}});
+
+  ns = reporter.TimeNsPerOp(n, [&] {
+    for (int i = 0; i < n; ++i)
+      ec_bench::DoNotOptimize(ImGui::ParseFlags<WindowFlags>(texts[i & 7]));
+  });
+  reporter.Add(
+    "ParseFlags", {{"ns_per_op", ns}, {"mb_per_s", bytes_per_op * 1e3 / ns}});
+
+  ns = reporter.TimeNsPerOp(n, [&] {
+    for (int i = 0; i < n; ++i)
+      ec_bench::DoNotOptimize(parse_linear(texts[i & 7]));
+  });
+  reporter.Add(
+    "linear parse", {{"ns_per_op", ns}, {"mb_per_s", bytes_per_op * 1e3 / ns}});
+  return 0;
+}
@@ -0,0 +1,151 @@
+// Per-window WindowFlags built from state booleans for a 500 window
+// workspace: if/else chains against FlagIf() and one FlagMask per window.
+// Each case is timed alone and inside a headless frame submitting every
+// window.
+
+#include "bench.hpp"
+
+#include <imgui_EnumClass.hpp>
+#include <imgui_EnumClass/FlagSet.hpp>
+
+#include <stdio.h> // snprintf
+#include <vector>
+
+namespace {
+  using ImGui::WindowFlags;
+
+  constexpr int kWindows = 500;
+
+  /// inputs of the flags of one window
+  struct WindowState {
+    char name[16];
+    bool locked;
+    bool menu;
+    bool title;
+    bool fit;
+    bool scroll;
+  };
+
+  std::vector<WindowState> make_workspace() {
+    std::vector<WindowState> windows(kWindows);
+    for (int i = 0; i < kWindows; ++i) {
+      WindowState& w = windows[i];
+      snprintf(w.name, sizeof(w.name), "window %03d", i);
+      w.locked = i % 3 == 0;
+      w.menu   = i % 5 == 0;
+      w.title  = i % 7 != 0;
+      w.fit    = i % 11 == 0;
+      w.scroll = i % 2 == 0;
+    }
+    return windows;
+  }
+
+  /// every 16th window changes state each frame, like a user dragging
+  /// windows around or docking them
+  void churn(std::vector<WindowState>& windows, int frame) {
+    for (int i = frame & 15; i < kWindows; i += 16)
+      windows[i].locked = !windows[i].locked;
+  }
+
+  WindowFlags flags_if_else(const WindowState& w) {
+    WindowFlags flags = WindowFlags::NoCollapse | WindowFlags::NoSavedSettings;
+    if (w.locked)
+      flags = flags | WindowFlags::NoMove | WindowFlags::NoResize;
+    if (w.menu)
+      flags = flags | WindowFlags::MenuBar;
+    if (!w.title)
+      flags = flags | WindowFlags::NoTitleBar;
+    if (w.fit)
+      flags = flags | WindowFlags::AlwaysAutoReize;
+    if (!w.scroll)
+      flags = flags | WindowFlags::NoScrollbar;
+    return flags;
+  }
+
+  WindowFlags flags_if(const WindowState& w) {
+    const WindowFlags lock = WindowFlags::NoMove | WindowFlags::NoResize;
+    return WindowFlags::NoCollapse | WindowFlags::NoSavedSettings |
+           ImGui::FlagIf(w.locked, lock) |
+           ImGui::FlagIf(w.menu, WindowFlags::MenuBar) |
+           ImGui::FlagIf(!w.title, WindowFlags::NoTitleBar) |
+           ImGui::FlagIf(w.fit, WindowFlags::AlwaysAutoReize) |
+           ImGui::FlagIf(!w.scroll, WindowFlags::NoScrollbar);
+  }
+
+  using Mask = ImGui::FlagMask<WindowFlags, 5>;
+
+  Mask make_mask() {
+    return Mask(
+      WindowFlags::NoCollapse | WindowFlags::NoSavedSettings,
+      WindowFlags::NoMove | WindowFlags::NoResize, WindowFlags::MenuBar,
+      WindowFlags::NoTitleBar, WindowFlags::AlwaysAutoReize,
+      WindowFlags::NoScrollbar);
+  }
+
+  WindowFlags flags_mask(Mask& mask, const WindowState& w) {
+    return mask(w.locked, w.menu, !w.title, w.fit, !w.scroll);
+  }
+
+  /// F(int i, const WindowState&) -> WindowFlags
+  template <class F>
+  void bench_flags(
+    ec_bench::Reporter& reporter,
+    ec_bench::Headless& headless,
+    const char* name,
+    const char* frame_name,
+    F&& flags_of) {
+    std::vector<WindowState> windows = make_workspace();
+
+    const int frames = reporter.Iterations(2000);
+    const double ns  = reporter.TimeNsPerOp(frames * kWindows, [&] {
+      for (int f = 0; f < frames; ++f) {
+        churn(windows, f);
+        for (int i = 0; i < kWindows; ++i)
+          ec_bench::DoNotOptimize(flags_of(i, windows[i]));
+      }
+    });
+    reporter.Add(name, {{"ns_per_window", ns}});
+
+    int frame = 0;
+    const ec_bench::FrameStats s =
+      headless.Run(reporter, reporter.Iterations(20), [&] {
+        churn(windows, frame++);
+        for (int i = 0; i < kWindows; ++i) {
+          const WindowState& w = windows[i];
+          ImGui::SetNextWindowPos(
+            ImVec2(
+              static_cast<float>(i % 25) * 76.0f,
+              static_cast<float>(i / 25) * 54.0f),
+            ImGuiCond_Always);
+          ImGui::SetNextWindowSize(ImVec2(72, 50), ImGuiCond_Always);
+          ImGui::Begin(w.name, NULL, flags_of(i, w));
+          ImGui::End();
+        }
+      });
+    reporter.Add(
+      frame_name,
+      {{"frame_ns", s.ns},
+       {"ns_per_window", s.ns / kWindows},
+       {"vtx", s.vtx},
+       {"idx", s.idx},
+       {"allocs", s.allocs}});
+  }
+} // namespace
+
+int main(int argc, char** argv) {
+  ec_bench::Reporter reporter("flag_mask", argc, argv);
+  ec_bench::Headless headless;
+
+  bench_flags(
+    reporter, headless, "if/else", "frame if/else",
+    [](int, const WindowState& w) { return flags_if_else(w); });
+  bench_flags(
+    reporter, headless, "FlagIf", "frame FlagIf",
+    [](int, const WindowState& w) { return flags_if(w); });
+
+  std::vector<Mask> masks(kWindows, make_mask());
+  bench_flags(
+    reporter, headless, "FlagMask", "frame FlagMask",
+    [&](int i, const WindowState& w) { return flags_mask(masks[i], w); });
+  return 0;
+}
@@ -0,0 +1,201 @@
+// Headless frames built with the wrappers of each section of the header:
+// windows and child windows, deep trees, InputText forms, ColorEdit4 grids,
+// DrawCornerFlags rect storms and drag/slider grids. Reports the frame
+// time, vertex and index counts and allocations per frame of each scene,
+// to follow them across ImGui versions.
+
+#include "bench.hpp"
+
+#include <imgui_EnumClass.hpp>
+
+#include <stdint.h> // intptr_t
+#include <stdio.h>  // snprintf
+
+namespace {
+  using ImGui::ColorEditFlags;
+  using ImGui::DrawCornerFlags;
+  using ImGui::InputTextFlags;
+  using ImGui::TreeNodeFlags;
+  using ImGui::WindowFlags;
+
+  /// a window covering the display, hosting one scene
+  template <class F>
+  void full_window(const char* name, F&& body) {
+    ImGui::SetNextWindowPos(ImVec2(0, 0), ImGuiCond_Always);
+    ImGui::SetNextWindowSize(ImGui::GetIO().DisplaySize, ImGuiCond_Always);
+    ImGui::Begin(name, NULL, WindowFlags::NoDecoration);
+    body();
+    ImGui::End();
+  }
+
+  // ----------------------------------------
+  // scenes
+
+  constexpr int kWindows = 100;
+  char window_names[kWindows][16];
+
+  /// kWindows windows with a bordered child each
+  void windows_scene() {
+    const WindowFlags flags[4] = {
+      WindowFlags::None, WindowFlags::NoCollapse,
+      WindowFlags::NoTitleBar | WindowFlags::NoResize,
+      WindowFlags::MenuBar | WindowFlags::NoSavedSettings};
+    for (int i = 0; i < kWindows; ++i) {
+      ImGui::SetNextWindowPos(
+        ImVec2(
+          static_cast<float>(i % 10) * 190.0f,
+          static_cast<float>(i / 10) * 105.0f),
+        ImGuiCond_Always);
+      ImGui::SetNextWindowSize(ImVec2(180, 100), ImGuiCond_Always);
+      ImGui::Begin(window_names[i], NULL, flags[i & 3]);
+      ImGui::BeginChild(
+        "child", ImVec2(0, 0), true, WindowFlags::HorizontalScrollbar);
+      ImGui::Text("window %d", i);
+      ImGui::EndChild();
+      ImGui::End();
+    }
+  }
+
+  /// complete binary tree of the given depth, every node open
+  void tree(int id, int depth) {
+    const TreeNodeFlags flags =
+      depth == 0 ? TreeNodeFlags::Leaf | TreeNodeFlags::DefaultOpen
+                 : TreeNodeFlags::OpenOnArrow | TreeNodeFlags::DefaultOpen;
+    const void* ptr_id = reinterpret_cast<void*>(static_cast<intptr_t>(id));
+    if (!ImGui::TreeNodeEx(ptr_id, flags, "%d", id))
+      return;
+    if (depth != 0) {
+      tree(id * 2, depth - 1);
+      tree(id * 2 + 1, depth - 1);
+    }
+    ImGui::TreePop();
+  }
+  void tree_scene() {
+    full_window("tree", [] { tree(1, 10); });
+  }
+
+  constexpr int kFields = 200;
+  char field_labels[kFields][16];
+  char field_values[kFields][64];
+
+  void input_text_scene() {
+    const InputTextFlags flags[4] = {
+      InputTextFlags::None, InputTextFlags::CharsDecimal,
+      InputTextFlags::CharsUppercase | InputTextFlags::AutoSelectAll,
+      InputTextFlags::ReadOnly};
+    full_window("form", [&] {
+      for (int i = 0; i < kFields; ++i)
+        ImGui::InputText(
+          field_labels[i], field_values[i], sizeof(field_values[i]),
+          flags[i & 3]);
+    });
+  }
+
+  constexpr int kColors = 20;
+  float colors[kColors * kColors][4];
+
+  void color_edit_scene() {
+    const ColorEditFlags flags = ColorEditFlags::NoInputs |
+                                 ColorEditFlags::NoLabel |
+                                 ColorEditFlags::AlphaPreviewHalf;
+    full_window("colors", [&] {
+      for (int i = 0; i < kColors * kColors; ++i) {
+        if (i % kColors != 0)
+          ImGui::SameLine();
+        ImGui::PushID(i);
+        ImGui::ColorEdit4("##color", colors[i], flags);
+        ImGui::PopID();
+      }
+    });
+  }
+
+  constexpr int kRects = 5000;
+
+  void rect_storm_scene() {
+    const DrawCornerFlags corners[4] = {
+      DrawCornerFlags::All, DrawCornerFlags::Top, DrawCornerFlags::Left,
+      DrawCornerFlags::TopLeft | DrawCornerFlags::BotRight};
+    full_window("rects", [&] {
+      ImDrawList* draw_list = ImGui::GetWindowDrawList();
+      for (int i = 0; i < kRects; ++i) {
+        const float x = static_cast<float>(i % 100) * 19.0f;
+        const float y = static_cast<float>(i / 100) * 19.0f;
+        ImGui::AddRectFilled(
+          draw_list, ImVec2(x, y), ImVec2(x + 16.0f, y + 16.0f),
+          IM_COL32(i * 7, i * 13, i * 29, 255), (i & 1) ? 4.0f : 0.0f,
+          corners[(i >> 1) & 3]);
+      }
+    });
+  }
+
+  constexpr int kSliders = 100;
+  float drag_values[kSliders];
+  int slider_values[kSliders];
+  float drag3_values[kSliders][3];
+  float slider4_values[kSliders][4];
+
+  void drag_slider_scene() {
+    full_window("sliders", [] {
+      for (int i = 0; i < kSliders; ++i) {
+        ImGui::PushID(i);
+        ImGui::DragScalar("drag", &drag_values[i], 0.1f);
+        ImGui::SliderScalar("slider", &slider_values[i], 0, 100);
+        ImGui::DragScalarN("drag3", drag3_values[i], 0.1f, -10.0f, 10.0f);
+        ImGui::SliderScalarN("slider4", slider4_values[i], 0.0f, 1.0f);
+        ImGui::PopID();
+      }
+    });
+  }
+
+  void init_scenes() {
+    for (int i = 0; i < kWindows; ++i)
+      snprintf(window_names[i], sizeof(window_names[i]), "window %03d", i);
+    for (int i = 0; i < kFields; ++i) {
+      snprintf(field_labels[i], sizeof(field_labels[i]), "field %03d", i);
+      snprintf(field_values[i], sizeof(field_values[i]), "%d", i * 37);
+    }
+    for (int i = 0; i < kColors * kColors; ++i) {
+      colors[i][0] = static_cast<float>(i % kColors) / kColors;
+      colors[i][1] = static_cast<float>(i / kColors) / kColors;
+      colors[i][2] = 0.5f;
+      colors[i][3] = static_cast<float>(i & 3) / 3.0f;
+    }
+    for (int i = 0; i < kSliders; ++i) {
+      drag_values[i]   = static_cast<float>(i);
+      slider_values[i] = i;
+      for (float& v : drag3_values[i])
+        v = static_cast<float>(i) * 0.1f;
+      for (float& v : slider4_values[i])
+        v = static_cast<float>(i) / kSliders;
+    }
+  }
+} // namespace
+
+int main(int argc, char** argv) {
+  ec_bench::Reporter reporter("frame", argc, argv);
+  ec_bench::Headless headless;
+  init_scenes();
+
+  const struct {
+    const char* name;
+    void (*build)();
+  } scenes[] = {
+    {"windows", windows_scene},
+    {"tree", tree_scene},
+    {"input_text", input_text_scene},
+    {"color_edit", color_edit_scene},
+    {"rect_storm", rect_storm_scene},
+    {"drag_slider", drag_slider_scene},
+  };
+  const int frames = reporter.Iterations(100);
+  for (const auto& scene : scenes) {
+    const ec_bench::FrameStats s = headless.Run(reporter, frames, scene.build);
+    reporter.Add(
+      scene.name,
+      {{"frame_ns", s.ns},
+       {"vtx", s.vtx},
+       {"idx", s.idx},
+       {"allocs", s.allocs}});
+  }
+  return 0;
+}
@@ -0,0 +1,92 @@
+// IsWindowHovered() queries from every level of deeply nested child
+// windows: ImGui's own function against HoverCache, one mask at a time and
+// with the batch overload.
+
+#include "bench.hpp"
+
+#include <imgui_EnumClass.hpp>
+#include <imgui_EnumClass/HoverCache.hpp>
+
+namespace {
+  using ImGui::HoveredFlags;
+
+  constexpr int kDepth   = 32; // nested child windows
+  constexpr int kRepeats = 4;  // queries of each mask per level
+
+  const HoveredFlags kMasks[] = {
+    HoveredFlags::None,
+    HoveredFlags::ChildWindows,
+    HoveredFlags::RootWindow,
+    HoveredFlags::RootAndChildWindows,
+    HoveredFlags::AnyWindow,
+    HoveredFlags::ChildWindows | HoveredFlags::AllowWhenBlockedByPopup,
+    HoveredFlags::ChildWindows | HoveredFlags::AllowWhenBlockedByActiveItem,
+    HoveredFlags::RootAndChildWindows | HoveredFlags::AllowWhenBlockedByPopup,
+  };
+  constexpr int kMaskCount = IM_ARRAYSIZE(kMasks);
+  constexpr int kQueries   = kDepth * kRepeats * kMaskCount;
+
+  /// query() is called inside each of the kDepth nested children
+  template <class F>
+  void nested(int level, F& query) {
+    if (level == kDepth)
+      return;
+    ImGui::BeginChild(
+      "child", ImVec2(0, 0), true, ImGui::WindowFlags::NoScrollbar);
+    query();
+    nested(level + 1, query);
+    ImGui::EndChild();
+  }
+
+  template <class F>
+  ec_bench::FrameStats run(
+    ec_bench::Reporter& reporter, ec_bench::Headless& headless, F&& query) {
+    return headless.Run(reporter, reporter.Iterations(200), [&] {
+      ImGui::SetNextWindowPos(ImVec2(0, 0), ImGuiCond_Always);
+      ImGui::SetNextWindowSize(ImGui::GetIO().DisplaySize, ImGuiCond_Always);
+      ImGui::Begin("root", NULL, ImGui::WindowFlags::NoDecoration);
+      nested(0, query);
+      ImGui::End();
+    });
+  }
+} // namespace
+
+int main(int argc, char** argv) {
+  ec_bench::Reporter reporter("hover_cache", argc, argv);
+  ec_bench::Headless headless;
+  // over the innermost child
+  ImGui::GetIO().MousePos = ImVec2(960, 540);
+
+  const ec_bench::FrameStats base = run(reporter, headless, [] {});
+  reporter.Add("nesting only", {{"frame_ns", base.ns}, {"depth", kDepth}});
+
+  auto add = [&](const char* name, const ec_bench::FrameStats& s) {
+    reporter.Add(
+      name,
+      {{"frame_ns", s.ns},
+       {"ns_per_query", (s.ns - base.ns) / kQueries},
+       {"queries", kQueries}});
+  };
+
+  add("ImGui::IsWindowHovered", run(reporter, headless, [] {
+        for (int r = 0; r < kRepeats; ++r)
+          for (HoveredFlags flags : kMasks)
+            ec_bench::DoNotOptimize(ImGui::IsWindowHovered(flags));
+      }));
+
+  ImGui::HoverCache cache;
+  add("HoverCache::IsWindowHovered", run(reporter, headless, [&] {
+        for (int r = 0; r < kRepeats; ++r)
+          for (HoveredFlags flags : kMasks)
+            ec_bench::DoNotOptimize(cache.IsWindowHovered(flags));
+      }));
+
+  add("HoverCache::IsWindowHovered batch", run(reporter, headless, [&] {
+        bool hovered[kMaskCount];
+        for (int r = 0; r < kRepeats; ++r) {
+          cache.IsWindowHovered(kMasks, hovered, kMaskCount);
+          ec_bench::DoNotOptimize(hovered);
+        }
+      }));
+  return 0;
+}
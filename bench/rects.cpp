@@ -0,0 +1,94 @@
+// AddRectsFilled against one AddRectFilled() wrapper call per rect, for a
+// storm of rects with and without rounded DrawCornerFlags corners.
+
+#include "bench.hpp"
+
+#include <imgui_EnumClass.hpp>
+
+#include <vector>
+
+namespace {
+  using ImGui::DrawCornerFlags;
+
+  /// count rects on a grid, every rounded_every-th one with rounded corners
+  std::vector<ImGui::RectFilled> make_rects(int count, int rounded_every) {
+    const DrawCornerFlags corners[4] = {
+      DrawCornerFlags::All, DrawCornerFlags::Top, DrawCornerFlags::Left,
+      DrawCornerFlags::TopLeft | DrawCornerFlags::BotRight};
+    std::vector<ImGui::RectFilled> rects(count);
+    for (int i = 0; i < count; ++i) {
+      ImGui::RectFilled& r = rects[i];
+      const float x        = static_cast<float>(i % 100) * 12.0f;
+      const float y        = static_cast<float>(i / 100) * 12.0f;
+      r.a                  = ImVec2(x, y);
+      r.b                  = ImVec2(x + 10.0f, y + 10.0f);
+      r.col                = IM_COL32(i * 7, i * 13, i * 29, 255);
+      const bool rounded   = rounded_every != 0 && i % rounded_every == 0;
+      r.rounding           = rounded ? 3.0f : 0.0f;
+      r.rounding_corners_flags =
+        rounded ? corners[(i / rounded_every) & 3] : DrawCornerFlags::All;
+    }
+    return rects;
+  }
+
+  template <class F>
+  void bench_rects(
+    ec_bench::Reporter& reporter,
+    ec_bench::Headless& headless,
+    const char* name,
+    int count,
+    F&& draw) {
+    const ec_bench::FrameStats s =
+      headless.Run(reporter, reporter.Iterations(50), [&] {
+        ImGui::SetNextWindowPos(ImVec2(0, 0));
+        ImGui::SetNextWindowSize(ImVec2(1280, 720));
+        ImGui::Begin("rects", NULL, ImGui::WindowFlags::NoDecoration);
+        draw(ImGui::GetWindowDrawList());
+        ImGui::End();
+      });
+    reporter.Add(
+      name,
+      {{"ns_per_rect", s.ns / count},
+       {"frame_ns", s.ns},
+       {"vtx", s.vtx},
+       {"idx", s.idx},
+       {"allocs", s.allocs}});
+  }
+} // namespace
+
+int main(int argc, char** argv) {
+  ec_bench::Reporter reporter("rects", argc, argv);
+  ec_bench::Headless headless;
+  const int count = 10000;
+
+  const struct {
+    const char* wrapper;
+    const char* raw;
+    const char* batch;
+    int rounded_every;
+  } sets[] = {
+    {"AddRectFilled sharp", "ImDrawList::AddRectFilled sharp",
+     "AddRectsFilled sharp", 0},
+    {"AddRectFilled 1/8 rounded", "ImDrawList::AddRectFilled 1/8 rounded",
+     "AddRectsFilled 1/8 rounded", 8},
+  };
+  for (const auto& set : sets) {
+    const std::vector<ImGui::RectFilled> rects =
+      make_rects(count, set.rounded_every);
+    bench_rects(reporter, headless, set.wrapper, count, [&](ImDrawList* dl) {
+      for (const ImGui::RectFilled& r : rects)
+        ImGui::AddRectFilled(
+          dl, r.a, r.b, r.col, r.rounding, r.rounding_corners_flags);
+    });
+    bench_rects(reporter, headless, set.raw, count, [&](ImDrawList* dl) {
+      for (const ImGui::RectFilled& r : rects)
+        dl->AddRectFilled(
+          r.a, r.b, r.col, r.rounding,
+          static_cast<int>(r.rounding_corners_flags));
+    });
+    bench_rects(reporter, headless, set.batch, count, [&](ImDrawList* dl) {
+      ImGui::AddRectsFilled(dl, rects.data(), count);
+    });
+  }
+  return 0;
+}
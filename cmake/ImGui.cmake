@@ -0,0 +1,63 @@
+# Resolves Dear ImGui for the tests and benchmarks, in this order:
+#   IMGUI_ENUM_CLASS_IMGUI_DIR   : a directory with imgui.h (and imgui.cpp)
+#   find_package(imgui CONFIG)   : e.g. vcpkg or conan
+#   IMGUI_ENUM_CLASS_FETCH_IMGUI : download IMGUI_ENUM_CLASS_IMGUI_TAG
+# Defines the targets
+#   imgui_enum_class_imgui_headers : include directories only
+#   imgui_enum_class_imgui         : the library, when sources were found
+# and IMGUI_ENUM_CLASS_IMGUI_FOUND when the latter exists.
+
+set(IMGUI_ENUM_CLASS_IMGUI_DIR "" CACHE PATH "Directory of imgui.h and imgui.cpp")
+option(IMGUI_ENUM_CLASS_FETCH_IMGUI "Download Dear ImGui when not found" OFF)
+set(IMGUI_ENUM_CLASS_IMGUI_TAG "v1.66b" CACHE STRING "Dear ImGui tag to download")
+
+add_library(imgui_enum_class_imgui_headers INTERFACE)
+set(IMGUI_ENUM_CLASS_IMGUI_FOUND OFF)
+
+if(NOT IMGUI_ENUM_CLASS_IMGUI_DIR)
+  find_package(imgui CONFIG QUIET)
+  if(TARGET imgui::imgui)
+    add_library(imgui_enum_class_imgui INTERFACE)
+    target_link_libraries(imgui_enum_class_imgui INTERFACE imgui::imgui)
+    target_link_libraries(imgui_enum_class_imgui_headers INTERFACE imgui::imgui)
+    set(IMGUI_ENUM_CLASS_IMGUI_FOUND ON)
+    return()
+  endif()
+
+  if(IMGUI_ENUM_CLASS_FETCH_IMGUI)
+    include(FetchContent)
+    FetchContent_Declare(
+      imgui
+      GIT_REPOSITORY https://github.com/ocornut/imgui.git
+      GIT_TAG ${IMGUI_ENUM_CLASS_IMGUI_TAG}
+      GIT_SHALLOW TRUE)
+    FetchContent_GetProperties(imgui)
+    if(NOT imgui_POPULATED)
+      FetchContent_Populate(imgui)
+    endif()
+    set(IMGUI_ENUM_CLASS_IMGUI_DIR ${imgui_SOURCE_DIR})
+  endif()
+endif()
+
+if(NOT EXISTS "${IMGUI_ENUM_CLASS_IMGUI_DIR}/imgui.h")
+  message(FATAL_ERROR
+    "Dear ImGui not found: set IMGUI_ENUM_CLASS_IMGUI_DIR, install an imgui "
+    "CMake package, or enable IMGUI_ENUM_CLASS_FETCH_IMGUI.")
+endif()
+
+target_include_directories(
+  imgui_enum_class_imgui_headers INTERFACE ${IMGUI_ENUM_CLASS_IMGUI_DIR})
+
+if(EXISTS "${IMGUI_ENUM_CLASS_IMGUI_DIR}/imgui.cpp")
+  set(_imgui_sources imgui.cpp imgui_draw.cpp)
+  # imgui_widgets.cpp was split out of imgui.cpp in 1.63
+  if(EXISTS "${IMGUI_ENUM_CLASS_IMGUI_DIR}/imgui_widgets.cpp")
+    list(APPEND _imgui_sources imgui_widgets.cpp)
+  endif()
+  list(TRANSFORM _imgui_sources PREPEND "${IMGUI_ENUM_CLASS_IMGUI_DIR}/")
+  add_library(imgui_enum_class_imgui STATIC ${_imgui_sources})
+  target_link_libraries(
+    imgui_enum_class_imgui PUBLIC imgui_enum_class_imgui_headers)
+  target_compile_features(imgui_enum_class_imgui PUBLIC cxx_std_17)
+  set(IMGUI_ENUM_CLASS_IMGUI_FOUND ON)
+endif()
@@ -0,0 +1,94 @@
+#pragma once
+
+#include "Style.hpp"
+
+#include <imgui_internal.h> // GImGui
+
+namespace ImGui {
+
+  /// Memoized GetColorU32(Col, alpha_mul) of the current style.
+  /// The cache is dropped when the context, the frame, the depth of the
+  /// color or style variable stacks, style.Alpha or TouchStyle() changes,
+  /// so pushes, pops and Alpha changes are picked up on the next lookup.
+  /// Call TouchStyle() after writing ImGuiStyle directly, or after popping
+  /// and pushing as many entries between two lookups.
+  class ColorU32Cache {
+  public:
+    constexpr ColorU32Cache()
+      : m_context(NULL)
+      , m_frame(0)
+      , m_color_depth(0)
+      , m_var_depth(0)
+      , m_alpha(0.0f)
+      , m_generation(0)
+      , m_stamp(0)
+      , m_entries() {}
+
+    /// same result as GetColorU32(idx, alpha_mul)
+    ImU32 Get(Col idx, float alpha_mul = 1.0f) {
+      Validate();
+      Entry& e = m_entries[static_cast<int>(idx)];
+      if (e.stamp == m_stamp && e.alpha_mul == alpha_mul)
+        return e.value;
+      e.stamp     = m_stamp;
+      e.alpha_mul = alpha_mul;
+      e.value     = ImGui::GetColorU32(idx, alpha_mul);
+      return e.value;
+    }
+
+    /// drop all cached values
+    void Clear() {
+      m_context = NULL;
+    }
+
+  private:
+    /// drops the entries when any value the colors depend on changed
+    void Validate() {
+      const ImGuiContext& g = *GImGui;
+      if (
+        m_context == GImGui && m_frame == g.FrameCount &&
+        m_color_depth == g.ColorModifiers.Size &&
+        m_var_depth == g.StyleModifiers.Size && m_alpha == g.Style.Alpha &&
+        m_generation == ec_detail::style_generation)
+        return;
+      m_context     = GImGui;
+      m_frame       = g.FrameCount;
+      m_color_depth = g.ColorModifiers.Size;
+      m_var_depth   = g.StyleModifiers.Size;
+      m_alpha       = g.Style.Alpha;
+      m_generation  = ec_detail::style_generation;
+      if (++m_stamp == 0) {
+        for (Entry& e : m_entries)
+          e.stamp = 0;
+        m_stamp = 1;
+      }
+    }
+
+    struct Entry {
+      ImU32 stamp; // 0: empty
+      float alpha_mul;
+      ImU32 value;
+    };
+
+    const ImGuiContext* m_context;
+    int m_frame;
+    int m_color_depth;
+    int m_var_depth;
+    float m_alpha;
+    ImU32 m_generation;
+    ImU32 m_stamp;
+    Entry m_entries[ImGuiCol_COUNT];
+  };
+
+  namespace ec_detail {
+    /// constant-initialized, so using it needs no guard
+    inline ColorU32Cache color_u32_cache;
+  } // namespace ec_detail
+
+  /// GetColorU32(Col, alpha_mul) served from a ColorU32Cache shared by the
+  /// ImGui contexts of the program
+  inline ImU32 GetColorU32Cached(Col idx, float alpha_mul = 1.0f) {
+    return ec_detail::color_u32_cache.Get(idx, alpha_mul);
+  }
+
+} // namespace ImGui
@@ -0,0 +1,270 @@
+#pragma once
+
+#include "Input.hpp"
+#include "Style.hpp"
+#include "Window.hpp"
+
+#include <atomic>
+#include <stddef.h> // size_t
+
+namespace ImGui {
+
+  /// operation of a UiCommand
+  enum class UiCommandOp : int {
+    SetNextWindowPos,
+    SetNextWindowSize,
+    SetNextWindowCollapsed,
+    SetWindowPos,
+    SetWindowSize,
+    SetWindowCollapsed,
+    SetMouseCursor,
+    PushStyleVarFloat,
+    PushStyleVarVec2,
+    PushStyleColor,
+    PopStyleVar,
+    PopStyleColor,
+  };
+
+  /// One deferred UI call. Plain data, so it can be copied between threads.
+  /// name must outlive the execution of the command (e.g. a string literal).
+  struct UiCommand {
+    UiCommandOp op;
+    Cond cond;
+    StyleVar style_var;
+    Col col;
+    MouseCursor cursor;
+    bool collapsed;
+    int count;
+    ImVec4 value; // pos/size/float value in x(y), pivot in zw, or a color
+    const char* name;
+
+    static UiCommand Make(UiCommandOp op) {
+      UiCommand cmd;
+      cmd.op        = op;
+      cmd.cond      = Cond::Always;
+      cmd.style_var = StyleVar::Alpha;
+      cmd.col       = Col::Text;
+      cmd.cursor    = MouseCursor::Arrow;
+      cmd.collapsed = false;
+      cmd.count     = 0;
+      cmd.value     = ImVec4(0, 0, 0, 0);
+      cmd.name      = NULL;
+      return cmd;
+    }
+  };
+
+  /// Executes cmd on the current ImGui context.
+  inline void ExecuteUiCommand(const UiCommand& cmd) {
+    const ImVec2 xy(cmd.value.x, cmd.value.y);
+    switch (cmd.op) {
+      case UiCommandOp::SetNextWindowPos:
+        ImGui::SetNextWindowPos(
+          xy, cmd.cond, ImVec2(cmd.value.z, cmd.value.w));
+        break;
+      case UiCommandOp::SetNextWindowSize:
+        ImGui::SetNextWindowSize(xy, cmd.cond);
+        break;
+      case UiCommandOp::SetNextWindowCollapsed:
+        ImGui::SetNextWindowCollapsed(cmd.collapsed, cmd.cond);
+        break;
+      case UiCommandOp::SetWindowPos:
+        ImGui::SetWindowPos(cmd.name, xy, cmd.cond);
+        break;
+      case UiCommandOp::SetWindowSize:
+        ImGui::SetWindowSize(cmd.name, xy, cmd.cond);
+        break;
+      case UiCommandOp::SetWindowCollapsed:
+        ImGui::SetWindowCollapsed(cmd.name, cmd.collapsed, cmd.cond);
+        break;
+      case UiCommandOp::SetMouseCursor:
+        ImGui::SetMouseCursor(cmd.cursor);
+        break;
+      case UiCommandOp::PushStyleVarFloat:
+        ImGui::PushStyleVar(cmd.style_var, cmd.value.x);
+        break;
+      case UiCommandOp::PushStyleVarVec2:
+        ImGui::PushStyleVar(cmd.style_var, xy);
+        break;
+      case UiCommandOp::PushStyleColor:
+        ImGui::PushStyleColor(cmd.col, cmd.value);
+        break;
+      case UiCommandOp::PopStyleVar:
+        ImGui::PopStyleVar(cmd.count);
+        break;
+      case UiCommandOp::PopStyleColor:
+        ImGui::PopStyleColor(cmd.count);
+        break;
+    }
+  }
+
+  /// Bounded lock-free queue of UiCommand with any number of producer
+  /// threads and one consumer (the UI thread).
+  /// Producers never block or allocate; a push fails when the queue is full.
+  /// ```
+  /// static ImGui::UiCommandQueue<> queue;
+  /// // simulation thread
+  /// queue.SetNextWindowPos(ImVec2(0, 0), ImGui::Cond::Always);
+  /// // UI thread, after NewFrame()
+  /// queue.Execute();
+  /// ```
+  template <size_t Capacity = 4096>
+  class UiCommandQueue {
+    static_assert(
+      Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+      "Capacity should be a power of two");
+
+  public:
+    UiCommandQueue()
+      : m_enqueue(0)
+      , m_dequeue(0) {
+      for (size_t i = 0; i < Capacity; ++i)
+        m_cells[i].seq.store(i, std::memory_order_relaxed);
+    }
+
+    UiCommandQueue(const UiCommandQueue&) = delete;
+    UiCommandQueue& operator=(const UiCommandQueue&) = delete;
+
+    /// enqueue from any thread, false when full
+    bool Push(const UiCommand& cmd) {
+      size_t pos = m_enqueue.load(std::memory_order_relaxed);
+      Cell* cell;
+      for (;;) {
+        cell             = &m_cells[pos & (Capacity - 1)];
+        const size_t seq = cell->seq.load(std::memory_order_acquire);
+        const ptrdiff_t diff =
+          static_cast<ptrdiff_t>(seq) - static_cast<ptrdiff_t>(pos);
+        if (diff == 0) {
+          if (m_enqueue.compare_exchange_weak(
+                pos, pos + 1, std::memory_order_relaxed))
+            break;
+        } else if (diff < 0) {
+          return false;
+        } else {
+          pos = m_enqueue.load(std::memory_order_relaxed);
+        }
+      }
+      cell->cmd = cmd;
+      cell->seq.store(pos + 1, std::memory_order_release);
+      return true;
+    }
+
+    /// dequeue on the consumer thread, false when empty
+    bool Pop(UiCommand& out) {
+      Cell& cell       = m_cells[m_dequeue & (Capacity - 1)];
+      const size_t seq = cell.seq.load(std::memory_order_acquire);
+      if (seq != m_dequeue + 1)
+        return false;
+      out = cell.cmd;
+      cell.seq.store(m_dequeue + Capacity, std::memory_order_release);
+      ++m_dequeue;
+      return true;
+    }
+
+    /// Executes the queued commands on the UI thread. Returns their number.
+    int Execute() {
+      int n = 0;
+      UiCommand cmd;
+      while (Pop(cmd)) {
+        ExecuteUiCommand(cmd);
+        ++n;
+      }
+      return n;
+    }
+
+    // typed producers
+
+    bool SetNextWindowPos(
+      const ImVec2& pos,
+      Cond cond           = Cond::Always,
+      const ImVec2& pivot = ImVec2(0, 0)) {
+      UiCommand cmd = UiCommand::Make(UiCommandOp::SetNextWindowPos);
+      cmd.value     = ImVec4(pos.x, pos.y, pivot.x, pivot.y);
+      cmd.cond      = cond;
+      return Push(cmd);
+    }
+    bool SetNextWindowSize(const ImVec2& size, Cond cond = Cond::Always) {
+      UiCommand cmd = UiCommand::Make(UiCommandOp::SetNextWindowSize);
+      cmd.value     = ImVec4(size.x, size.y, 0, 0);
+      cmd.cond      = cond;
+      return Push(cmd);
+    }
+    bool SetNextWindowCollapsed(bool collapsed, Cond cond = Cond::Always) {
+      UiCommand cmd = UiCommand::Make(UiCommandOp::SetNextWindowCollapsed);
+      cmd.collapsed = collapsed;
+      cmd.cond      = cond;
+      return Push(cmd);
+    }
+    bool SetWindowPos(
+      const char* name, const ImVec2& pos, Cond cond = Cond::Always) {
+      UiCommand cmd = UiCommand::Make(UiCommandOp::SetWindowPos);
+      cmd.name      = name;
+      cmd.value     = ImVec4(pos.x, pos.y, 0, 0);
+      cmd.cond      = cond;
+      return Push(cmd);
+    }
+    bool SetWindowSize(
+      const char* name, const ImVec2& size, Cond cond = Cond::Always) {
+      UiCommand cmd = UiCommand::Make(UiCommandOp::SetWindowSize);
+      cmd.name      = name;
+      cmd.value     = ImVec4(size.x, size.y, 0, 0);
+      cmd.cond      = cond;
+      return Push(cmd);
+    }
+    bool SetWindowCollapsed(
+      const char* name, bool collapsed, Cond cond = Cond::Always) {
+      UiCommand cmd = UiCommand::Make(UiCommandOp::SetWindowCollapsed);
+      cmd.name      = name;
+      cmd.collapsed = collapsed;
+      cmd.cond      = cond;
+      return Push(cmd);
+    }
+    bool SetMouseCursor(MouseCursor cursor) {
+      UiCommand cmd = UiCommand::Make(UiCommandOp::SetMouseCursor);
+      cmd.cursor    = cursor;
+      return Push(cmd);
+    }
+    bool PushStyleVar(StyleVar idx, float val) {
+      UiCommand cmd = UiCommand::Make(UiCommandOp::PushStyleVarFloat);
+      cmd.style_var = idx;
+      cmd.value     = ImVec4(val, 0, 0, 0);
+      return Push(cmd);
+    }
+    bool PushStyleVar(StyleVar idx, const ImVec2& val) {
+      UiCommand cmd = UiCommand::Make(UiCommandOp::PushStyleVarVec2);
+      cmd.style_var = idx;
+      cmd.value     = ImVec4(val.x, val.y, 0, 0);
+      return Push(cmd);
+    }
+    bool PushStyleColor(Col idx, const ImVec4& col) {
+      UiCommand cmd = UiCommand::Make(UiCommandOp::PushStyleColor);
+      cmd.col       = idx;
+      cmd.value     = col;
+      return Push(cmd);
+    }
+    bool PushStyleColor(Col idx, ImU32 col) {
+      return PushStyleColor(idx, ImGui::ColorConvertU32ToFloat4(col));
+    }
+    bool PopStyleVar(int count = 1) {
+      UiCommand cmd = UiCommand::Make(UiCommandOp::PopStyleVar);
+      cmd.count     = count;
+      return Push(cmd);
+    }
+    bool PopStyleColor(int count = 1) {
+      UiCommand cmd = UiCommand::Make(UiCommandOp::PopStyleColor);
+      cmd.count     = count;
+      return Push(cmd);
+    }
+
+  private:
+    struct Cell {
+      std::atomic<size_t> seq;
+      UiCommand cmd;
+    };
+
+    // producers and the consumer write different cache lines
+    alignas(64) std::atomic<size_t> m_enqueue;
+    alignas(64) size_t m_dequeue;
+    alignas(64) Cell m_cells[Capacity];
+  };
+
+} // namespace ImGui
@@ -0,0 +1,182 @@
+#pragma once
+
+#include "Flags.hpp"
+
+namespace ImGui {
+
+  // ----------------------------------------
+  // DrawCornerFlags
+
+  /// ImDrawCornerFlags
+  enum class DrawCornerFlags : int {
+    TopLeft  = ImDrawCornerFlags_TopLeft,
+    TopRight = ImDrawCornerFlags_TopRight,
+    BotLeft  = ImDrawCornerFlags_BotLeft,
+    BotRight = ImDrawCornerFlags_BotRight,
+    Top      = ImDrawCornerFlags_Top,
+    Bot      = ImDrawCornerFlags_Bot,
+    Left     = ImDrawCornerFlags_Left,
+    Right    = ImDrawCornerFlags_Right,
+    All      = ImDrawCornerFlags_All,
+  };
+
+  template <>
+  struct ec_detail::is_enum_flag<DrawCornerFlags> : std::true_type {};
+
+  inline void AddRect(
+    ImDrawList* draw_list,
+    const ImVec2& a,
+    const ImVec2& b,
+    ImU32 col,
+    float rounding,
+    DrawCornerFlags rounding_corners_flags,
+    float thickness = 1.0f) {
+    return draw_list->AddRect(
+      a, b, col, rounding, static_cast<int>(rounding_corners_flags), thickness);
+  }
+
+  inline void AddRectFilled(
+    ImDrawList* draw_list,
+    const ImVec2& a,
+    const ImVec2& b,
+    ImU32 col,
+    float rounding,
+    DrawCornerFlags rounding_corners_flags) {
+    return draw_list->AddRectFilled(
+      a, b, col, rounding, static_cast<int>(rounding_corners_flags));
+  }
+  inline void PathRect(
+    ImDrawList* draw_list,
+    const ImVec2& rect_min,
+    const ImVec2& rect_max,
+    float rounding,
+    DrawCornerFlags rounding_corners_flags) {
+    return draw_list->PathRect(
+      rect_min, rect_max, rounding, static_cast<int>(rounding_corners_flags));
+  }
+  inline void AddImageRounded(
+    ImDrawList* draw_list,
+    ImTextureID user_texture_id,
+    const ImVec2& a,
+    const ImVec2& b,
+    const ImVec2& uv_a,
+    const ImVec2& uv_b,
+    ImU32 col,
+    float rounding,
+    DrawCornerFlags rounding_corners) {
+    return draw_list->AddImageRounded(
+      user_texture_id, a, b, uv_a, uv_b, col, rounding,
+      static_cast<int>(rounding_corners));
+  }
+
+  /// Arguments of one AddRectFilled() call, for AddRectsFilled()
+  struct RectFilled {
+    ImVec2 a;
+    ImVec2 b;
+    ImU32 col;
+    float rounding;
+    DrawCornerFlags rounding_corners_flags;
+  };
+
+  namespace ec_detail {
+    /// no rounded corner, drawn as one quad
+    inline bool is_sharp_rect(const RectFilled& r) {
+      return r.rounding <= 0.0f || !r.rounding_corners_flags;
+    }
+
+    /// PrimRect() for every visible rect, after a single PrimReserve()
+    inline void prim_rects(
+      ImDrawList* draw_list,
+      const RectFilled* rects,
+      int count,
+      int visible,
+      const ImVec2& uv) {
+      draw_list->PrimReserve(visible * 6, visible * 4);
+      ImDrawVert* vtx   = draw_list->_VtxWritePtr;
+      ImDrawIdx* idx    = draw_list->_IdxWritePtr;
+      unsigned int base = draw_list->_VtxCurrentIdx;
+      for (int i = 0; i < count; ++i) {
+        const RectFilled& r = rects[i];
+        if ((r.col & IM_COL32_A_MASK) == 0)
+          continue;
+        vtx[0].pos = r.a;
+        vtx[1].pos = ImVec2(r.b.x, r.a.y);
+        vtx[2].pos = r.b;
+        vtx[3].pos = ImVec2(r.a.x, r.b.y);
+        for (int v = 0; v < 4; ++v) {
+          vtx[v].uv  = uv;
+          vtx[v].col = r.col;
+        }
+        idx[0] = static_cast<ImDrawIdx>(base);
+        idx[1] = static_cast<ImDrawIdx>(base + 1);
+        idx[2] = static_cast<ImDrawIdx>(base + 2);
+        idx[3] = static_cast<ImDrawIdx>(base);
+        idx[4] = static_cast<ImDrawIdx>(base + 2);
+        idx[5] = static_cast<ImDrawIdx>(base + 3);
+        vtx += 4;
+        idx += 6;
+        base += 4;
+      }
+      draw_list->_VtxWritePtr   = vtx;
+      draw_list->_IdxWritePtr   = idx;
+      draw_list->_VtxCurrentIdx = base;
+    }
+  } // namespace ec_detail
+
+  /// Draws rects[0..count) in order, like calling AddRectFilled() for each.
+  /// Consecutive rects without rounded corners share one PrimReserve() and
+  /// are written as plain quads without building a path (unlike
+  /// AddRectFilled(), a rect with rounding > 0 but no corners gets no
+  /// anti-aliased fringe). Fully transparent rects are skipped.
+  inline void AddRectsFilled(
+    ImDrawList* draw_list,
+    const RectFilled* rects,
+    int count) {
+    const ImVec2 uv = ImGui::GetFontTexUvWhitePixel();
+    int i           = 0;
+    while (i < count) {
+      if (!ec_detail::is_sharp_rect(rects[i])) {
+        const RectFilled& r = rects[i++];
+        if ((r.col & IM_COL32_A_MASK) == 0)
+          continue;
+        draw_list->PathRect(
+          r.a, r.b, r.rounding, static_cast<int>(r.rounding_corners_flags));
+        draw_list->PathFillConvex(r.col);
+        continue;
+      }
+      int end     = i;
+      int visible = 0;
+      for (; end < count && ec_detail::is_sharp_rect(rects[end]); ++end)
+        visible += (rects[end].col & IM_COL32_A_MASK) != 0;
+      if (visible != 0)
+        ec_detail::prim_rects(draw_list, rects + i, end - i, visible, uv);
+      i = end;
+    }
+  }
+
+  // ----------------------------------------
+  // DrawListFlags
+
+  /// ImDrawListFlags
+  enum class DrawListFlags : int {
+    AntiAliasedLines = ImDrawListFlags_AntiAliasedLines,
+    AntiAliasedFill  = ImDrawListFlags_AntiAliasedFill,
+  };
+
+  template <>
+  struct ec_detail::is_enum_flag<DrawListFlags> : std::true_type {};
+
+  // ----------------------------------------
+  // FontAtlasFlags
+
+  /// ImFontAtlasFlags
+  enum class FontAtlasFlags : int {
+    None               = ImFontAtlasFlags_None,
+    NoPowerOfTwoHeight = ImFontAtlasFlags_NoPowerOfTwoHeight,
+    NoMouseCursors     = ImFontAtlasFlags_NoMouseCursors,
+  };
+
+  template <>
+  struct ec_detail::is_enum_flag<FontAtlasFlags> : std::true_type {};
+
+} // namespace ImGui
@@ -0,0 +1,201 @@
+#pragma once
+
+#include "DrawList.hpp"
+
+#include <string.h> // memcpy
+
+namespace ImGui {
+
+  /// Geometry appended to an ImDrawList between Begin() and End(), which can
+  /// be copied into later frames instead of being tessellated again.
+  /// ```
+  /// static ImGui::DrawRecording bg;
+  /// ImDrawList* dl = ImGui::GetWindowDrawList();
+  /// ImVec2 pos     = ImGui::GetCursorScreenPos();
+  /// if (bg.IsValid(dl, key)) {
+  ///   bg.Replay(dl, pos);
+  /// } else {
+  ///   bg.Begin(dl, key, pos);
+  ///   ImGui::AddRectFilled(dl, pos, max, col, 4.0f, corners);
+  ///   bg.End(dl);
+  /// }
+  /// ```
+  class DrawRecording {
+  public:
+    DrawRecording()
+      : m_key(0)
+      , m_flags()
+      , m_uv_white(0, 0)
+      , m_origin(0, 0)
+      , m_recording(false)
+      , m_valid(false)
+      , m_vtx_begin(0)
+      , m_idx_begin(0)
+      , m_cmd_begin(0) {}
+
+    /// Starts capturing what is added to draw_list.
+    /// key identifies the inputs of the recorded block, origin is the
+    /// position Replay() translates from.
+    void Begin(ImDrawList* draw_list, ImGuiID key, const ImVec2& origin) {
+      IM_ASSERT(!m_recording && "DrawRecording::Begin() called twice");
+      Clear();
+      m_key       = key;
+      m_flags     = static_cast<DrawListFlags>(draw_list->Flags);
+      m_uv_white  = ImGui::GetFontTexUvWhitePixel();
+      m_origin    = origin;
+      m_recording = true;
+
+      m_vtx_begin = draw_list->_VtxCurrentIdx;
+      m_idx_begin = draw_list->IdxBuffer.Size;
+      m_cmd_begin = draw_list->CmdBuffer.Size - 1;
+    }
+
+    /// Stops capturing. The recording is left invalid when the block used
+    /// draw callbacks, which cannot be replayed.
+    void End(ImDrawList* draw_list) {
+      IM_ASSERT(m_recording && "DrawRecording::End() without Begin()");
+      m_recording = false;
+
+      const int vtx_count =
+        static_cast<int>(draw_list->_VtxCurrentIdx - m_vtx_begin);
+      const int idx_count = draw_list->IdxBuffer.Size - m_idx_begin;
+
+      // The recorded indices are the last idx_count ones, so the commands
+      // holding them are found from the end: a PushClipRect() or
+      // PushTextureID() in the block may have merged the command current at
+      // Begin() into the previous one.
+      unsigned int remaining = static_cast<unsigned int>(idx_count);
+      for (int i = draw_list->CmdBuffer.Size - 1;
+           i >= 0 && (remaining != 0 || i >= m_cmd_begin);
+           --i) {
+        const ImDrawCmd& cmd = draw_list->CmdBuffer[i];
+        if (cmd.UserCallback) {
+          Clear();
+          return;
+        }
+        const unsigned int elem_count =
+          cmd.ElemCount < remaining ? cmd.ElemCount : remaining;
+        remaining -= elem_count;
+        if (elem_count == 0)
+          continue;
+        if (!m_segments.empty() && m_segments.back().texture == cmd.TextureId)
+          m_segments.back().elem_count += elem_count;
+        else
+          m_segments.push_back(Segment {cmd.TextureId, elem_count});
+      }
+      if (remaining != 0) {
+        Clear();
+        return;
+      }
+      for (int i = 0, j = m_segments.Size - 1; i < j; ++i, --j) {
+        const Segment tmp = m_segments[i];
+        m_segments[i]     = m_segments[j];
+        m_segments[j]     = tmp;
+      }
+
+      m_vtx.resize(vtx_count);
+      if (vtx_count != 0)
+        memcpy(
+          m_vtx.Data, draw_list->VtxBuffer.Data + m_vtx_begin,
+          vtx_count * sizeof(ImDrawVert));
+
+      // store indices relative to the first recorded vertex
+      m_idx.resize(idx_count);
+      const ImDrawIdx* src = draw_list->IdxBuffer.Data + m_idx_begin;
+      for (int i = 0; i < idx_count; ++i)
+        m_idx[i] = static_cast<ImDrawIdx>(src[i] - m_vtx_begin);
+
+      m_valid = true;
+    }
+
+    /// true when the recording was made with key and can be replayed into
+    /// draw_list as is (same DrawListFlags and font atlas white pixel)
+    bool IsValid(const ImDrawList* draw_list, ImGuiID key) const {
+      if (!m_valid || m_key != key)
+        return false;
+      if (static_cast<DrawListFlags>(draw_list->Flags) != m_flags)
+        return false;
+      const ImVec2 uv = ImGui::GetFontTexUvWhitePixel();
+      return uv.x == m_uv_white.x && uv.y == m_uv_white.y;
+    }
+
+    /// Appends the recorded geometry to draw_list, translated so that the
+    /// recorded origin lands on origin. Uses the current clip rect of
+    /// draw_list.
+    void Replay(ImDrawList* draw_list, const ImVec2& origin) const {
+      IM_ASSERT(m_valid && "DrawRecording::Replay() on invalid recording");
+      if (m_idx.Size == 0)
+        return;
+
+      const ImVec2 offset(origin.x - m_origin.x, origin.y - m_origin.y);
+      const unsigned int base = draw_list->_VtxCurrentIdx;
+
+      // vertices are shared by all segments, reserve them up front
+      draw_list->PrimReserve(0, m_vtx.Size);
+      ImDrawVert* vtx = draw_list->_VtxWritePtr;
+      memcpy(vtx, m_vtx.Data, m_vtx.Size * sizeof(ImDrawVert));
+      if (offset.x != 0.0f || offset.y != 0.0f) {
+        for (int i = 0; i < m_vtx.Size; ++i) {
+          vtx[i].pos.x += offset.x;
+          vtx[i].pos.y += offset.y;
+        }
+      }
+      draw_list->_VtxWritePtr += m_vtx.Size;
+      draw_list->_VtxCurrentIdx += m_vtx.Size;
+
+      const ImDrawIdx* src = m_idx.Data;
+      for (const Segment& seg : m_segments) {
+        const int n = static_cast<int>(seg.elem_count);
+        const bool push_texture =
+          draw_list->_TextureIdStack.empty() ||
+          draw_list->_TextureIdStack.back() != seg.texture;
+        if (push_texture)
+          draw_list->PushTextureID(seg.texture);
+
+        draw_list->PrimReserve(n, 0);
+        ImDrawIdx* idx = draw_list->_IdxWritePtr;
+        for (int i = 0; i < n; ++i)
+          idx[i] = static_cast<ImDrawIdx>(src[i] + base);
+        draw_list->_IdxWritePtr += n;
+        src += n;
+
+        if (push_texture)
+          draw_list->PopTextureID();
+      }
+    }
+
+    /// DrawListFlags the recording was made with
+    DrawListFlags GetFlags() const {
+      return m_flags;
+    }
+
+    /// drop recorded geometry
+    void Clear() {
+      m_vtx.resize(0);
+      m_idx.resize(0);
+      m_segments.resize(0);
+      m_valid = false;
+    }
+
+  private:
+    /// run of indices drawn with one texture
+    struct Segment {
+      ImTextureID texture;
+      unsigned int elem_count;
+    };
+
+    ImVector<ImDrawVert> m_vtx;
+    ImVector<ImDrawIdx> m_idx;
+    ImVector<Segment> m_segments;
+    ImGuiID m_key;
+    DrawListFlags m_flags;
+    ImVec2 m_uv_white;
+    ImVec2 m_origin;
+    bool m_recording;
+    bool m_valid;
+    unsigned int m_vtx_begin;
+    int m_idx_begin;
+    int m_cmd_begin;
+  };
+
+} // namespace ImGui
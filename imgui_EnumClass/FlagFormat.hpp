@@ -0,0 +1,194 @@
+#pragma once
+
+#include "Reflection.hpp"
+
+#include <utility> // pair
+
+namespace ImGui {
+
+  namespace ec_detail {
+    constexpr int popcount_slow(unsigned int v) {
+      int n = 0;
+      for (; v; v &= v - 1)
+        ++n;
+      return n;
+    }
+
+    /// non-zero named values, widest first (composites before single bits)
+    template <class E, size_t N>
+    constexpr auto sort_entries_for_format(std::array<enum_entry<E>, N> a) {
+      size_t n = 0;
+      for (size_t i = 0; i < N; ++i)
+        if (to_underlying_type(a[i].value) != 0)
+          a[n++] = a[i];
+      for (size_t i = 1; i < n; ++i) {
+        for (size_t j = i; j > 0; --j) {
+          auto lhs = static_cast<unsigned int>(to_underlying_type(a[j].value));
+          auto rhs =
+            static_cast<unsigned int>(to_underlying_type(a[j - 1].value));
+          if (!(popcount_slow(lhs) > popcount_slow(rhs)))
+            break;
+          auto tmp = a[j];
+          a[j]     = a[j - 1];
+          a[j - 1] = tmp;
+        }
+      }
+      return std::pair {a, n};
+    }
+
+    template <class E>
+    struct flag_format_table {
+      static constexpr auto sorted =
+        sort_entries_for_format(enum_table<E>::by_value);
+      static constexpr auto& entries = sorted.first;
+      static constexpr size_t count  = sorted.second;
+    };
+
+    /// writes into fixed buffer, counts full length
+    struct flag_buffer_sink {
+      char* buf;
+      size_t buf_size;
+      size_t len;
+
+      constexpr void put(const char* b, const char* e) {
+        for (; b != e; ++b, ++len)
+          if (len + 1 < buf_size)
+            buf[len] = *b;
+      }
+      constexpr void finish() {
+        if (buf_size != 0)
+          buf[len < buf_size ? len : buf_size - 1] = '\0';
+      }
+    };
+
+    /// appends to ImGuiTextBuffer
+    struct flag_text_buffer_sink {
+      ImGuiTextBuffer& buf;
+
+      void put(const char* b, const char* e) {
+        buf.append(b, e);
+      }
+    };
+
+    template <class E, class Sink>
+    constexpr void format_flags(E flags, Sink& sink) {
+      using table = flag_format_table<E>;
+
+      auto rest = static_cast<unsigned int>(to_underlying_type(flags));
+
+      if (rest == 0) {
+        const char* name = EnumName(flags);
+        if (!name)
+          name = "0";
+        sink.put(name, name + std::string_view(name).size());
+        return;
+      }
+
+      bool first = true;
+      for (size_t i = 0; i < table::count && rest != 0; ++i) {
+        const auto& entry = table::entries[i];
+        auto bits = static_cast<unsigned int>(to_underlying_type(entry.value));
+        if ((rest & bits) != bits)
+          continue;
+        if (!first)
+          sink.put("|", "|" + 1);
+        const char* name = entry.name;
+        sink.put(name, name + std::string_view(name).size());
+        rest &= ~bits;
+        first = false;
+      }
+
+      // bits without name
+      if (rest != 0) {
+        char hex[2 + 8] = {'0', 'x'};
+        int len         = 2;
+        for (int shift = 28; shift >= 0; shift -= 4) {
+          unsigned int d = (rest >> shift) & 0xF;
+          if (d == 0 && len == 2)
+            continue;
+          hex[len++] = static_cast<char>(d < 10 ? '0' + d : 'A' + d - 10);
+        }
+        if (!first)
+          sink.put("|", "|" + 1);
+        sink.put(hex, hex + len);
+      }
+    }
+
+    constexpr std::string_view trim_flag_token(std::string_view s) {
+      while (!s.empty() && (s.front() == ' ' || s.front() == '\t'))
+        s.remove_prefix(1);
+      while (!s.empty() && (s.back() == ' ' || s.back() == '\t'))
+        s.remove_suffix(1);
+      return s;
+    }
+
+    constexpr std::optional<unsigned int> parse_flag_hex(std::string_view s) {
+      if (s.size() < 3 || s.size() > 10 || s[0] != '0' || s[1] != 'x')
+        return std::nullopt;
+      unsigned int v = 0;
+      for (size_t i = 2; i < s.size(); ++i) {
+        char c = s[i];
+        if (c >= '0' && c <= '9')
+          v = (v << 4) | static_cast<unsigned int>(c - '0');
+        else if (c >= 'A' && c <= 'F')
+          v = (v << 4) | static_cast<unsigned int>(c - 'A' + 10);
+        else if (c >= 'a' && c <= 'f')
+          v = (v << 4) | static_cast<unsigned int>(c - 'a' + 10);
+        else
+          return std::nullopt;
+      }
+      return v;
+    }
+  } // namespace ec_detail
+
+  /// Writes flags as "Name|Name|..." into buf.
+  /// Composite names (NoDecoration, All, ...) are used whenever all of their
+  /// bits are set, bits without a name are written as one hex number.
+  /// Output is always null terminated when buf_size != 0. Returns the length
+  /// of the full string, so a return value >= buf_size means truncation.
+  template <
+    class Flag,
+    std::enable_if_t<ec_detail::is_enum_flag_v<Flag>, std::nullptr_t> = nullptr>
+  constexpr size_t FormatFlags(Flag flags, char* buf, size_t buf_size) {
+    ec_detail::flag_buffer_sink sink {buf, buf_size, 0};
+    ec_detail::format_flags(flags, sink);
+    sink.finish();
+    return sink.len;
+  }
+
+  /// Appends flags as "Name|Name|..." to buf.
+  template <
+    class Flag,
+    std::enable_if_t<ec_detail::is_enum_flag_v<Flag>, std::nullptr_t> = nullptr>
+  void FormatFlags(Flag flags, ImGuiTextBuffer& buf) {
+    ec_detail::flag_text_buffer_sink sink {buf};
+    ec_detail::format_flags(flags, sink);
+  }
+
+  /// Parses output of FormatFlags.
+  /// Returns nullopt on empty input or on any unknown name.
+  template <
+    class Flag,
+    std::enable_if_t<ec_detail::is_enum_flag_v<Flag>, std::nullptr_t> = nullptr>
+  constexpr std::optional<Flag> ParseFlags(std::string_view str) {
+    using namespace ec_detail;
+    unsigned int bits = 0;
+    while (true) {
+      size_t sep = str.find('|');
+      auto token = trim_flag_token(str.substr(0, sep));
+      if (token.empty())
+        return std::nullopt;
+      if (auto value = EnumFromName<Flag>(token))
+        bits |= static_cast<unsigned int>(to_underlying_type(*value));
+      else if (auto hex = parse_flag_hex(token))
+        bits |= *hex;
+      else if (token != "0")
+        return std::nullopt;
+      if (sep == std::string_view::npos)
+        break;
+      str.remove_prefix(sep + 1);
+    }
+    return static_cast<Flag>(bits);
+  }
+
+} // namespace ImGui
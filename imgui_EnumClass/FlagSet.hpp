@@ -0,0 +1,343 @@
+#pragma once
+
+#include "Flags.hpp"
+
+#include <stddef.h> // size_t
+
+namespace ImGui {
+
+  namespace ec_detail {
+    /// number of set bits
+    constexpr int popcount(unsigned int v) {
+#if defined(__GNUC__) || defined(__clang__)
+      return __builtin_popcount(v);
+#else
+      v = v - ((v >> 1) & 0x55555555u);
+      v = (v & 0x33333333u) + ((v >> 2) & 0x33333333u);
+      v = (v + (v >> 4)) & 0x0F0F0F0Fu;
+      return static_cast<int>((v * 0x01010101u) >> 24);
+#endif
+    }
+
+    /// index of lowest set bit (v != 0)
+    constexpr int countr_zero(unsigned int v) {
+#if defined(__GNUC__) || defined(__clang__)
+      return __builtin_ctz(v);
+#else
+      int n = 0;
+      for (; !(v & 1u); v >>= 1)
+        ++n;
+      return n;
+#endif
+    }
+
+    template <class E>
+    constexpr unsigned int to_bits(E e) {
+      return static_cast<unsigned int>(to_underlying_type(e));
+    }
+    template <class E>
+    constexpr E from_bits(unsigned int bits) {
+      return static_cast<E>(static_cast<std::underlying_type_t<E>>(bits));
+    }
+  } // namespace ec_detail
+
+  /// Value type holding a set of flags of E.
+  /// Converts to E implicitly, so it can be passed to the wrappers directly.
+  template <class E>
+  class Flags {
+    static_assert(ec_detail::is_enum_flag_v<E>, "E should be a flag enum");
+
+  public:
+    using enum_type = E;
+
+    /// iterates over set bits, lowest first, as single-bit E values
+    class iterator {
+    public:
+      constexpr iterator(unsigned int bits)
+        : m_bits(bits) {}
+      constexpr E operator*() const {
+        return ec_detail::from_bits<E>(m_bits & (~m_bits + 1u));
+      }
+      constexpr iterator& operator++() {
+        m_bits &= m_bits - 1u;
+        return *this;
+      }
+      constexpr bool operator==(const iterator& rhs) const {
+        return m_bits == rhs.m_bits;
+      }
+      constexpr bool operator!=(const iterator& rhs) const {
+        return m_bits != rhs.m_bits;
+      }
+
+    private:
+      unsigned int m_bits;
+    };
+
+    constexpr Flags()
+      : m_bits(0) {}
+    constexpr Flags(E flags)
+      : m_bits(ec_detail::to_bits(flags)) {}
+
+    constexpr operator E() const {
+      return ec_detail::from_bits<E>(m_bits);
+    }
+    constexpr E Get() const {
+      return ec_detail::from_bits<E>(m_bits);
+    }
+
+    /// all bits of mask are set
+    constexpr bool Test(E mask) const {
+      return All(mask);
+    }
+    /// any bit is set
+    constexpr bool Any() const {
+      return m_bits != 0;
+    }
+    /// any bit of mask is set
+    constexpr bool Any(E mask) const {
+      return (m_bits & ec_detail::to_bits(mask)) != 0;
+    }
+    /// all bits of mask are set
+    constexpr bool All(E mask) const {
+      return (m_bits & ec_detail::to_bits(mask)) == ec_detail::to_bits(mask);
+    }
+    /// no bit is set
+    constexpr bool None() const {
+      return m_bits == 0;
+    }
+    /// no bit of mask is set
+    constexpr bool None(E mask) const {
+      return (m_bits & ec_detail::to_bits(mask)) == 0;
+    }
+    /// number of set bits
+    constexpr int Count() const {
+      return ec_detail::popcount(m_bits);
+    }
+    /// lowest set bit, or zero
+    constexpr E Lowest() const {
+      return ec_detail::from_bits<E>(m_bits & (~m_bits + 1u));
+    }
+    /// index of lowest set bit, or -1
+    constexpr int LowestIndex() const {
+      return m_bits ? ec_detail::countr_zero(m_bits) : -1;
+    }
+
+    constexpr Flags& Set(E mask, bool value = true) {
+      if (value)
+        m_bits |= ec_detail::to_bits(mask);
+      else
+        m_bits &= ~ec_detail::to_bits(mask);
+      return *this;
+    }
+    constexpr Flags& Reset(E mask) {
+      return Set(mask, false);
+    }
+    constexpr Flags& Flip(E mask) {
+      m_bits ^= ec_detail::to_bits(mask);
+      return *this;
+    }
+
+    constexpr iterator begin() const {
+      return iterator(m_bits);
+    }
+    constexpr iterator end() const {
+      return iterator(0);
+    }
+
+    friend constexpr Flags operator|(Flags lhs, Flags rhs) {
+      return Flags(lhs.m_bits | rhs.m_bits, 0);
+    }
+    friend constexpr Flags operator&(Flags lhs, Flags rhs) {
+      return Flags(lhs.m_bits & rhs.m_bits, 0);
+    }
+    friend constexpr Flags operator^(Flags lhs, Flags rhs) {
+      return Flags(lhs.m_bits ^ rhs.m_bits, 0);
+    }
+    constexpr Flags operator~() const {
+      return Flags(~m_bits, 0);
+    }
+    constexpr bool operator!() const {
+      return m_bits == 0;
+    }
+    constexpr Flags& operator|=(Flags rhs) {
+      m_bits |= rhs.m_bits;
+      return *this;
+    }
+    constexpr Flags& operator&=(Flags rhs) {
+      m_bits &= rhs.m_bits;
+      return *this;
+    }
+    constexpr Flags& operator^=(Flags rhs) {
+      m_bits ^= rhs.m_bits;
+      return *this;
+    }
+
+    // E on either side would be ambiguous with built-in E == E
+    friend constexpr bool operator==(Flags lhs, Flags rhs) {
+      return lhs.m_bits == rhs.m_bits;
+    }
+    friend constexpr bool operator==(Flags lhs, E rhs) {
+      return lhs.m_bits == ec_detail::to_bits(rhs);
+    }
+    friend constexpr bool operator==(E lhs, Flags rhs) {
+      return ec_detail::to_bits(lhs) == rhs.m_bits;
+    }
+    friend constexpr bool operator!=(Flags lhs, Flags rhs) {
+      return !(lhs == rhs);
+    }
+    friend constexpr bool operator!=(Flags lhs, E rhs) {
+      return !(lhs == rhs);
+    }
+    friend constexpr bool operator!=(E lhs, Flags rhs) {
+      return !(lhs == rhs);
+    }
+
+  private:
+    constexpr Flags(unsigned int bits, int)
+      : m_bits(bits) {}
+
+    unsigned int m_bits;
+  };
+
+  // ----------------------------------------
+  // Building masks from conditions.
+
+  /// flag when cond is true, otherwise zero.
+  /// Folds to a constant when cond is known at compile time:
+  /// ```
+  /// constexpr auto flags = ImGui::WindowFlags::NoCollapse |
+  ///                        ImGui::FlagIf(kLocked, ImGui::WindowFlags::NoMove);
+  /// ```
+  template <
+    class Flag,
+    std::enable_if_t<ec_detail::is_enum_flag_v<Flag>, std::nullptr_t> = nullptr>
+  constexpr Flag FlagIf(bool cond, Flag flag) {
+    return ec_detail::from_bits<Flag>(
+      ec_detail::to_bits(flag) & (0u - static_cast<unsigned int>(cond)));
+  }
+
+  /// Mask made of a base value plus one flag per boolean input, recomputed
+  /// only when the inputs differ from the previous call.
+  /// ```
+  /// static ImGui::FlagMask mask(
+  ///   ImGui::WindowFlags::NoCollapse, // always set
+  ///   ImGui::WindowFlags::NoMove,     // set when 1st input is true
+  ///   ImGui::WindowFlags::MenuBar);   // set when 2nd input is true
+  /// ImGui::Begin("window", NULL, mask(locked, has_menu));
+  /// ```
+  template <class E, size_t N>
+  class FlagMask {
+    static_assert(ec_detail::is_enum_flag_v<E>, "E should be a flag enum");
+    static_assert(N != 0 && N <= 32, "FlagMask takes 1 to 32 inputs");
+
+  public:
+    template <class... Es>
+    constexpr FlagMask(E base, Es... flags)
+      : m_base(ec_detail::to_bits(base))
+      , m_flags {ec_detail::to_bits(E(flags))...}
+      , m_inputs(0)
+      , m_mask(m_base) {
+      static_assert(sizeof...(Es) == N, "one flag per input");
+    }
+
+    /// mask for the given inputs, one bool per flag
+    template <class... Bools>
+    constexpr E operator()(Bools... inputs) {
+      static_assert(sizeof...(Bools) == N, "one input per flag");
+      unsigned int key = 0;
+      unsigned int bit = 0;
+      (..., (key |= static_cast<unsigned int>(static_cast<bool>(inputs))
+                    << bit++));
+      if (key != m_inputs) {
+        m_inputs = key;
+        m_mask   = m_base;
+        for (size_t i = 0; i < N; ++i)
+          m_mask |= m_flags[i] & (0u - ((key >> i) & 1u));
+      }
+      return ec_detail::from_bits<E>(m_mask);
+    }
+
+    /// mask of the last call
+    constexpr E Get() const {
+      return ec_detail::from_bits<E>(m_mask);
+    }
+
+  private:
+    unsigned int m_base;
+    unsigned int m_flags[N];
+    unsigned int m_inputs; // bit i: input i of the last call
+    unsigned int m_mask;
+  };
+
+  template <class E, class... Es>
+  FlagMask(E, Es...)->FlagMask<E, sizeof...(Es)>;
+
+  // ----------------------------------------
+  // Bulk operations on contiguous flag arrays.
+  // Written as plain branchless loops so compilers can vectorize them.
+
+  /// flags[i] |= mask
+  template <
+    class Flag,
+    std::enable_if_t<ec_detail::is_enum_flag_v<Flag>, std::nullptr_t> = nullptr>
+  void FlagsOr(Flag* flags, size_t count, Flag mask) {
+    const unsigned int m = ec_detail::to_bits(mask);
+    for (size_t i = 0; i < count; ++i)
+      flags[i] = ec_detail::from_bits<Flag>(ec_detail::to_bits(flags[i]) | m);
+  }
+
+  /// flags[i] &= mask
+  template <
+    class Flag,
+    std::enable_if_t<ec_detail::is_enum_flag_v<Flag>, std::nullptr_t> = nullptr>
+  void FlagsAnd(Flag* flags, size_t count, Flag mask) {
+    const unsigned int m = ec_detail::to_bits(mask);
+    for (size_t i = 0; i < count; ++i)
+      flags[i] = ec_detail::from_bits<Flag>(ec_detail::to_bits(flags[i]) & m);
+  }
+
+  /// out[i] = flags[i] has any bit of mask
+  template <
+    class Flag,
+    std::enable_if_t<ec_detail::is_enum_flag_v<Flag>, std::nullptr_t> = nullptr>
+  void FlagsTestAny(const Flag* flags, size_t count, Flag mask, bool* out) {
+    const unsigned int m = ec_detail::to_bits(mask);
+    for (size_t i = 0; i < count; ++i)
+      out[i] = (ec_detail::to_bits(flags[i]) & m) != 0;
+  }
+
+  /// out[i] = flags[i] has all bits of mask
+  template <
+    class Flag,
+    std::enable_if_t<ec_detail::is_enum_flag_v<Flag>, std::nullptr_t> = nullptr>
+  void FlagsTestAll(const Flag* flags, size_t count, Flag mask, bool* out) {
+    const unsigned int m = ec_detail::to_bits(mask);
+    for (size_t i = 0; i < count; ++i)
+      out[i] = (ec_detail::to_bits(flags[i]) & m) == m;
+  }
+
+  /// number of flags[i] which have any bit of mask
+  template <
+    class Flag,
+    std::enable_if_t<ec_detail::is_enum_flag_v<Flag>, std::nullptr_t> = nullptr>
+  size_t FlagsCountAny(const Flag* flags, size_t count, Flag mask) {
+    const unsigned int m = ec_detail::to_bits(mask);
+    size_t n             = 0;
+    for (size_t i = 0; i < count; ++i)
+      n += (ec_detail::to_bits(flags[i]) & m) != 0;
+    return n;
+  }
+
+  /// number of flags[i] which have all bits of mask
+  template <
+    class Flag,
+    std::enable_if_t<ec_detail::is_enum_flag_v<Flag>, std::nullptr_t> = nullptr>
+  size_t FlagsCountAll(const Flag* flags, size_t count, Flag mask) {
+    const unsigned int m = ec_detail::to_bits(mask);
+    size_t n             = 0;
+    for (size_t i = 0; i < count; ++i)
+      n += (ec_detail::to_bits(flags[i]) & m) == m;
+    return n;
+  }
+
+} // namespace ImGui
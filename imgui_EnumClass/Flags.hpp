@@ -0,0 +1,125 @@
+#pragma once
+
+#include <imgui.h>
+#include <type_traits>
+
+// Define IMGUI_ENUM_CLASS_CHECK_FLAGS to IM_ASSERT() on conflicting flags
+// passed to wrappers at runtime. Template overloads taking flags as a template
+// argument (e.g. ImGui::Begin<ImGui::WindowFlags::NoMove>(name)) always check
+// them with static_assert.
+#if defined(IMGUI_ENUM_CLASS_CHECK_FLAGS)
+#  define IMGUI_EC_CHECK_FLAGS(valid) IM_ASSERT((valid) && "conflicting flags")
+#else
+#  define IMGUI_EC_CHECK_FLAGS(valid) ((void)0)
+#endif
+
+// Define IMGUI_ENUM_CLASS_ENABLE_HOOKS to count wrapper calls, see Hooks.hpp.
+#if defined(IMGUI_ENUM_CLASS_ENABLE_HOOKS)
+#  include "Hooks.hpp"
+#  define IMGUI_EC_HOOK(name) IMGUI_EC_HOOK_IMPL(name)
+#else
+#  define IMGUI_EC_HOOK(name) ((void)0)
+#endif
+
+namespace ImGui {
+
+  namespace ec_detail {
+    /// create enum class from value
+    template <class E>
+    constexpr std::underlying_type_t<E> to_underlying_type(E e) {
+      return static_cast<std::underlying_type_t<E>>(e);
+    }
+    /// trait class to use SFINAE on enum class types
+    template <class T>
+    struct is_enum_flag : std::false_type {};
+
+    /// alias
+    template <class T>
+    static constexpr bool is_enum_flag_v = is_enum_flag<T>::value;
+
+    /// any bit of mask is set in flags
+    template <class E>
+    constexpr bool has_any(E flags, E mask) {
+      return (to_underlying_type(flags) & to_underlying_type(mask)) != 0;
+    }
+    /// more than one bit of mask is set in flags
+    template <class E>
+    constexpr bool has_many(E flags, E mask) {
+      auto bits = to_underlying_type(flags) & to_underlying_type(mask);
+      return (bits & (bits - 1)) != 0;
+    }
+  } // namespace enum_class_detail
+
+  // operator|
+  template <
+    class Flag,
+    std::enable_if_t<ec_detail::is_enum_flag_v<Flag>, std::nullptr_t> = nullptr>
+  constexpr Flag operator|(Flag lhs, Flag rhs) {
+    using namespace ec_detail;
+    return static_cast<Flag>(to_underlying_type(lhs) | to_underlying_type(rhs));
+  }
+
+  // operator|=
+  template <
+    class Flag,
+    std::enable_if_t<ec_detail::is_enum_flag_v<Flag>, std::nullptr_t> = nullptr>
+  constexpr Flag& operator|=(Flag& lhs, Flag rhs) {
+    lhs = lhs | rhs;
+    return lhs;
+  }
+
+  // operator&
+  template <
+    class Flag,
+    std::enable_if_t<ec_detail::is_enum_flag_v<Flag>, std::nullptr_t> = nullptr>
+  constexpr Flag operator&(Flag lhs, Flag rhs) {
+    using namespace ec_detail;
+    return static_cast<Flag>(to_underlying_type(lhs) & to_underlying_type(rhs));
+  }
+
+  // operator&=
+  template <
+    class Flag,
+    std::enable_if_t<ec_detail::is_enum_flag_v<Flag>, std::nullptr_t> = nullptr>
+  constexpr Flag& operator&=(Flag& lhs, Flag rhs) {
+    lhs = lhs & rhs;
+    return lhs;
+  }
+
+  // operator^
+  template <
+    class Flag,
+    std::enable_if_t<ec_detail::is_enum_flag_v<Flag>, std::nullptr_t> = nullptr>
+  constexpr Flag operator^(Flag lhs, Flag rhs) {
+    using namespace ec_detail;
+    return static_cast<Flag>(to_underlying_type(lhs) ^ to_underlying_type(rhs));
+  }
+
+  // operator^=
+  template <
+    class Flag,
+    std::enable_if_t<ec_detail::is_enum_flag_v<Flag>, std::nullptr_t> = nullptr>
+  constexpr Flag& operator^=(Flag& lhs, Flag rhs) {
+    lhs = lhs ^ rhs;
+    return lhs;
+  }
+
+  // operator~
+  template <
+    class Flag,
+    std::enable_if_t<ec_detail::is_enum_flag_v<Flag>, std::nullptr_t> = nullptr>
+  constexpr Flag operator~(Flag flag) {
+    using namespace ec_detail;
+    return static_cast<Flag>(~(to_underlying_type(flag)));
+  }
+
+  // operator!
+  template <
+    class Flag,
+    std::enable_if_t<ec_detail::is_enum_flag_v<Flag>, std::nullptr_t> = nullptr>
+  constexpr bool operator!(Flag flag) {
+    using namespace ec_detail;
+    return !(to_underlying_type(flag));
+  }
+
+} // namespace ImGui
@@ -0,0 +1,192 @@
+#pragma once
+
+#include <imgui.h>
+
+#include <atomic>
+#include <chrono>
+#include <string.h> // strcmp
+
+// Instrumentation of the wrappers.
+// Define IMGUI_ENUM_CLASS_ENABLE_HOOKS to count calls of each wrapper, and
+// IMGUI_ENUM_CLASS_HOOK_TIMING to also time them and keep the last
+// IMGUI_ENUM_CLASS_HOOK_RING_SIZE calls in a ring buffer.
+// Everything is recorded per thread without locks; the functions below read
+// the data of the calling thread.
+// Without IMGUI_ENUM_CLASS_ENABLE_HOOKS the wrappers contain no hook code.
+
+#if !defined(IMGUI_ENUM_CLASS_HOOK_RING_SIZE)
+#  define IMGUI_ENUM_CLASS_HOOK_RING_SIZE 1024
+#endif
+
+namespace ImGui {
+
+  namespace ec_detail {
+    static_assert(
+      (IMGUI_ENUM_CLASS_HOOK_RING_SIZE &
+       (IMGUI_ENUM_CLASS_HOOK_RING_SIZE - 1)) == 0,
+      "IMGUI_ENUM_CLASS_HOOK_RING_SIZE should be a power of two");
+
+    struct hook_site;
+
+    /// one timed wrapper call
+    struct hook_event {
+      const hook_site* site;
+      ImU64 begin_ns;
+      ImU64 end_ns;
+    };
+
+    /// hook data of one thread
+    struct hook_thread_state {
+      hook_thread_state()
+        : sites(nullptr)
+        , ring_head(0)
+        , thread_index(next_thread_index()++) {}
+
+      static std::atomic<int>& next_thread_index() {
+        static std::atomic<int> index {0};
+        return index;
+      }
+
+      hook_site* sites;
+      unsigned int ring_head; // number of events written so far
+      int thread_index;
+      hook_event ring[IMGUI_ENUM_CLASS_HOOK_RING_SIZE];
+    };
+
+    inline hook_thread_state& hook_state() {
+      thread_local hook_thread_state state;
+      return state;
+    }
+
+    /// counters of one wrapper, one instance per thread
+    struct hook_site {
+      explicit hook_site(const char* site_name)
+        : name(site_name)
+        , count(0)
+        , ns(0)
+        , last_count(0)
+        , last_ns(0) {
+        hook_thread_state& state = hook_state();
+        next                     = state.sites;
+        state.sites              = this;
+      }
+
+      const char* name;
+      unsigned int count; // since HooksNewFrame()
+      ImU64 ns;
+      unsigned int last_count; // previous frame
+      ImU64 last_ns;
+      hook_site* next;
+    };
+
+    inline ImU64 hook_now() {
+      using namespace std::chrono;
+      return static_cast<ImU64>(
+        duration_cast<nanoseconds>(steady_clock::now().time_since_epoch())
+          .count());
+    }
+
+    /// counts (and times) the enclosing wrapper call
+    class hook_scope {
+    public:
+      explicit hook_scope(hook_site& site)
+        : m_site(site) {
+        ++site.count;
+#if defined(IMGUI_ENUM_CLASS_HOOK_TIMING)
+        m_begin = hook_now();
+#endif
+      }
+#if defined(IMGUI_ENUM_CLASS_HOOK_TIMING)
+      ~hook_scope() {
+        const ImU64 end = hook_now();
+        m_site.ns += end - m_begin;
+        hook_thread_state& state = hook_state();
+        const unsigned int mask  = IMGUI_ENUM_CLASS_HOOK_RING_SIZE - 1;
+        hook_event& e            = state.ring[state.ring_head++ & mask];
+        e.site     = &m_site;
+        e.begin_ns = m_begin;
+        e.end_ns   = end;
+      }
+#endif
+
+      hook_scope(const hook_scope&) = delete;
+      hook_scope& operator=(const hook_scope&) = delete;
+
+    private:
+      hook_site& m_site;
+#if defined(IMGUI_ENUM_CLASS_HOOK_TIMING)
+      ImU64 m_begin;
+#endif
+    };
+  } // namespace ec_detail
+
+  /// Moves call counts and times of this thread into the "previous frame"
+  /// slots shown by ShowHooksOverlay(). Call once per frame.
+  inline void HooksNewFrame() {
+    for (auto* s = ec_detail::hook_state().sites; s; s = s->next) {
+      s->last_count = s->count;
+      s->last_ns    = s->ns;
+      s->count      = 0;
+      s->ns         = 0;
+    }
+  }
+
+  /// Window listing calls and time per wrapper in the previous frame.
+  /// Overloads of the same wrapper are summed.
+  inline void ShowHooksOverlay(bool* p_open = NULL) {
+    if (!ImGui::Begin(
+          "Wrapper hooks", p_open, ImGuiWindowFlags_AlwaysAutoResize)) {
+      ImGui::End();
+      return;
+    }
+    ec_detail::hook_site* sites = ec_detail::hook_state().sites;
+    for (auto* s = sites; s; s = s->next) {
+      bool seen = false;
+      for (auto* p = sites; p != s && !seen; p = p->next)
+        seen = strcmp(p->name, s->name) == 0;
+      if (seen)
+        continue;
+      unsigned int count = 0;
+      ImU64 ns           = 0;
+      for (auto* p = s; p; p = p->next) {
+        if (strcmp(p->name, s->name) != 0)
+          continue;
+        count += p->last_count;
+        ns += p->last_ns;
+      }
+#if defined(IMGUI_ENUM_CLASS_HOOK_TIMING)
+      ImGui::Text("%-24s %6u calls %10.3f us", s->name, count, ns / 1000.0);
+#else
+      (void)ns;
+      ImGui::Text("%-24s %6u calls", s->name, count);
+#endif
+    }
+    ImGui::End();
+  }
+
+  /// Appends the ring buffer of this thread as Chrome trace event JSON
+  /// (chrome://tracing, Perfetto). Empty without IMGUI_ENUM_CLASS_HOOK_TIMING.
+  inline void WriteHooksTrace(ImGuiTextBuffer& buf) {
+    const ec_detail::hook_thread_state& state = ec_detail::hook_state();
+    const unsigned int size  = IMGUI_ENUM_CLASS_HOOK_RING_SIZE;
+    const unsigned int end   = state.ring_head;
+    const unsigned int begin = end > size ? end - size : 0;
+
+    buf.append("{\"traceEvents\":[");
+    for (unsigned int i = begin; i != end; ++i) {
+      const ec_detail::hook_event& e = state.ring[i & (size - 1)];
+      buf.appendf(
+        "%s\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":0,\"tid\":%d,"
+        "\"ts\":%.3f,\"dur\":%.3f}",
+        i == begin ? "" : ",", e.site->name, state.thread_index,
+        e.begin_ns / 1000.0, (e.end_ns - e.begin_ns) / 1000.0);
+    }
+    buf.append("\n]}\n");
+  }
+
+} // namespace ImGui
+
+/// counts the enclosing function as a call of wrapper name
+#define IMGUI_EC_HOOK_IMPL(name)                                 \
+  thread_local ::ImGui::ec_detail::hook_site ec_hook_site_(name); \
+  ::ImGui::ec_detail::hook_scope ec_hook_scope_(ec_hook_site_)
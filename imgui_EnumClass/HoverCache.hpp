@@ -0,0 +1,225 @@
+#pragma once
+
+#include "Window.hpp"
+
+#include <imgui_internal.h> // GImGui, ImGuiWindow, IsWindowChildOf
+#include <stdint.h>         // uintptr_t
+#include <string.h>         // memset
+
+namespace ImGui {
+
+  /// Memoises IsWindowHovered(), IsWindowFocused() and IsItemHovered() per
+  /// (window, item, flags) for the current frame.
+  /// The cache is dropped when the frame, the active item or whether it
+  /// allows overlap (SetItemAllowOverlap()), the focused or the hovered
+  /// window changes, so results always match ImGui's.
+  /// Use one cache per ImGui context.
+  /// ```
+  /// static ImGui::HoverCache hover;
+  /// const auto flags =
+  ///   ImGui::HoveredFlags::RootAndChildWindows |
+  ///   ImGui::HoveredFlags::AllowWhenBlockedByPopup;
+  /// if (hover.IsWindowHovered(flags)) ...
+  ///
+  /// const ImGui::HoveredFlags masks[] = {
+  ///   ImGui::HoveredFlags::None, ImGui::HoveredFlags::ChildWindows, flags};
+  /// bool hovered[3];
+  /// hover.IsWindowHovered(masks, hovered, 3);
+  /// ```
+  class HoverCache {
+  public:
+    HoverCache()
+      : m_stamp(1)
+      , m_frame(-1)
+      , m_active_id(0)
+      , m_active_allow_overlap(false)
+      , m_nav_window(NULL)
+      , m_hovered_window(NULL) {
+      memset(m_entries, 0, sizeof(m_entries));
+    }
+
+    bool IsWindowHovered(HoveredFlags flags) {
+      Validate();
+      Entry& e = Slot(GImGui->CurrentWindow, 0, Key(kWindowHovered, flags));
+      if (e.stamp != m_stamp)
+        Store(e, ImGui::IsWindowHovered(flags));
+      return e.value;
+    }
+
+    bool IsWindowFocused(FocusedFlags flags) {
+      Validate();
+      Entry& e = Slot(GImGui->CurrentWindow, 0, Key(kWindowFocused, flags));
+      if (e.stamp != m_stamp)
+        Store(e, ImGui::IsWindowFocused(flags));
+      return e.value;
+    }
+
+    /// IsItemHovered() of the last item. Items without an id (e.g. Text)
+    /// are not cached.
+    bool IsItemHovered(HoveredFlags flags) {
+      Validate();
+      ImGuiWindow* window = GImGui->CurrentWindow;
+      const ImGuiID item  = window->DC.LastItemId;
+      if (item == 0)
+        return ImGui::IsItemHovered(flags);
+      Entry& e = Slot(window, item, Key(kItemHovered, flags));
+      if (e.stamp != m_stamp || e.hovered_id != GImGui->HoveredId) {
+        Store(e, ImGui::IsItemHovered(flags));
+        e.hovered_id = GImGui->HoveredId;
+      }
+      return e.value;
+    }
+
+    /// out[i] = IsWindowHovered(masks[i]). The window tests of
+    /// ImGui::IsWindowHovered() (ImGui 1.66) are evaluated once for all
+    /// masks, each mask then only selects which of them apply.
+    void IsWindowHovered(const HoveredFlags* masks, bool* out, int count) {
+      const ImGuiContext& g = *GImGui;
+      ImGuiWindow* window   = g.CurrentWindow;
+      ImGuiWindow* hovered  = g.HoveredWindow;
+
+      // which window has to be hovered
+      const bool any  = hovered != NULL;
+      const bool self = any && hovered == window;
+      const bool root = any && hovered == window->RootWindow;
+      const bool root_and_child =
+        any && g.HoveredRootWindow == window->RootWindow;
+      const bool child = any && ImGui::IsWindowChildOf(hovered, window);
+
+      // IsWindowContentHoverable(): a focused modal blocks other windows,
+      // a focused popup unless AllowWhenBlockedByPopup
+      bool blocked_by_modal = false;
+      bool blocked_by_popup = false;
+      if (any && g.NavWindow) {
+        const ImGuiWindow* focused_root = g.NavWindow->RootWindow;
+        if (
+          focused_root && focused_root->WasActive &&
+          focused_root != g.HoveredRootWindow->RootWindow) {
+          if (focused_root->Flags & ImGuiWindowFlags_Modal)
+            blocked_by_modal = true;
+          else if (focused_root->Flags & ImGuiWindowFlags_Popup)
+            blocked_by_popup = true;
+        }
+      }
+      // an active item blocks unless AllowWhenBlockedByActiveItem, or
+      // unless it is the hovered window being moved
+      const bool blocked_by_active_item =
+        any && g.ActiveId != 0 && !g.ActiveIdAllowOverlap &&
+        g.ActiveId != hovered->MoveId;
+
+      const HoveredFlags scope =
+        HoveredFlags::RootWindow | HoveredFlags::ChildWindows;
+      for (int i = 0; i < count; ++i) {
+        const HoveredFlags flags = masks[i];
+        bool hit;
+        if (ec_detail::has_any(flags, HoveredFlags::AnyWindow))
+          hit = any;
+        else if ((flags & scope) == scope)
+          hit = root_and_child;
+        else if (ec_detail::has_any(flags, HoveredFlags::RootWindow))
+          hit = root;
+        else if (ec_detail::has_any(flags, HoveredFlags::ChildWindows))
+          hit = child;
+        else
+          hit = self;
+        if (blocked_by_modal)
+          hit = false;
+        if (
+          blocked_by_popup &&
+          !ec_detail::has_any(flags, HoveredFlags::AllowWhenBlockedByPopup))
+          hit = false;
+        if (
+          blocked_by_active_item &&
+          !ec_detail::has_any(
+            flags, HoveredFlags::AllowWhenBlockedByActiveItem))
+          hit = false;
+        out[i] = hit;
+      }
+    }
+
+    /// out[i] = IsWindowFocused(masks[i])
+    void IsWindowFocused(const FocusedFlags* masks, bool* out, int count) {
+      for (int i = 0; i < count; ++i)
+        out[i] = IsWindowFocused(masks[i]);
+    }
+
+    /// drops all results, e.g. after moving focus by hand
+    void Invalidate() {
+      NextStamp();
+    }
+
+  private:
+    static constexpr int kSize = 256; // power of two
+
+    enum Kind : int {
+      kWindowHovered,
+      kWindowFocused,
+      kItemHovered,
+    };
+
+    struct Entry {
+      const ImGuiWindow* window;
+      ImGuiID item;
+      ImGuiID hovered_id;
+      int key;
+      ImU32 stamp; // valid when equal to m_stamp
+      bool value;
+    };
+
+    template <class E>
+    static int Key(Kind kind, E flags) {
+      return (static_cast<int>(flags) << 2) | kind;
+    }
+
+    /// starts a new generation when the state queries depend on changed
+    void Validate() {
+      const ImGuiContext& g = *GImGui;
+      if (
+        g.FrameCount == m_frame && g.ActiveId == m_active_id &&
+        g.ActiveIdAllowOverlap == m_active_allow_overlap &&
+        g.NavWindow == m_nav_window && g.HoveredWindow == m_hovered_window)
+        return;
+      m_frame                = g.FrameCount;
+      m_active_id            = g.ActiveId;
+      m_active_allow_overlap = g.ActiveIdAllowOverlap;
+      m_nav_window           = g.NavWindow;
+      m_hovered_window       = g.HoveredWindow;
+      NextStamp();
+    }
+
+    void NextStamp() {
+      if (++m_stamp == 0) // 0 marks empty slots
+        m_stamp = 1;
+    }
+
+    /// Slot of (window, item, key), reset when it held another query.
+    /// The table is direct-mapped: a collision evicts the older result.
+    Entry& Slot(const ImGuiWindow* window, ImGuiID item, int key) {
+      ImU64 h = static_cast<ImU64>(reinterpret_cast<uintptr_t>(window));
+      h ^= (static_cast<ImU64>(item) << 32) ^ static_cast<ImU64>(key);
+      h *= 0x9E3779B97F4A7C15ull;
+      Entry& e = m_entries[(h >> 32) & (kSize - 1)];
+      if (e.window != window || e.item != item || e.key != key) {
+        e.window = window;
+        e.item   = item;
+        e.key    = key;
+        e.stamp  = 0;
+      }
+      return e;
+    }
+
+    void Store(Entry& e, bool value) {
+      e.value = value;
+      e.stamp = m_stamp;
+    }
+
+    Entry m_entries[kSize];
+    ImU32 m_stamp;
+    int m_frame;
+    ImGuiID m_active_id;
+    bool m_active_allow_overlap;
+    const ImGuiWindow* m_nav_window;
+    const ImGuiWindow* m_hovered_window;
+  };
+
+} // namespace ImGui
@@ -0,0 +1,772 @@
+#pragma once
+
+#include "Flags.hpp"
+
+#include <utility> // declval
+
+namespace ImGui {
+
+  // ----------------------------------------
+  // Key
+
+  /// ImGuiKey
+  enum class Key : int {
+    Tab        = ImGuiKey_Tab,
+    LeftArrow  = ImGuiKey_LeftArrow,
+    RightArrow = ImGuiKey_RightArrow,
+    UpArrow    = ImGuiKey_UpArrow,
+    DownArrow  = ImGuiKey_DownArrow,
+    PageUp     = ImGuiKey_PageUp,
+    PageDown   = ImGuiKey_PageDown,
+    Home       = ImGuiKey_Home,
+    End        = ImGuiKey_End,
+    Insert     = ImGuiKey_Insert,
+    Delete     = ImGuiKey_Delete,
+    Backspace  = ImGuiKey_Backspace,
+    Space      = ImGuiKey_Space,
+    Enter      = ImGuiKey_Enter,
+    Escape     = ImGuiKey_Escape,
+    A          = ImGuiKey_A,
+    C          = ImGuiKey_C,
+    V          = ImGuiKey_V,
+    X          = ImGuiKey_X,
+    Y          = ImGuiKey_Y,
+    Z          = ImGuiKey_Z,
+  };
+
+  inline int GetKeyIndex(Key imgui_key) {
+    return ImGui::GetKeyIndex(static_cast<ImGuiKey>(imgui_key));
+  }
+
+  // ----------------------------------------
+  // NavInput
+
+  /// ImGuiNavInput
+  enum class NavInput : int {
+    // Gamepad Mapping
+    Activate    = ImGuiNavInput_Activate,
+    Cancel      = ImGuiNavInput_Cancel,
+    Input       = ImGuiNavInput_Input,
+    Menu        = ImGuiNavInput_Menu,
+    DpadLeft    = ImGuiNavInput_DpadLeft,
+    DpadRight   = ImGuiNavInput_DpadRight,
+    DpadUp      = ImGuiNavInput_DpadUp,
+    DpadDown    = ImGuiNavInput_DpadDown,
+    LStickLeft  = ImGuiNavInput_LStickLeft,
+    LStickRight = ImGuiNavInput_LStickRight,
+    LStickUp    = ImGuiNavInput_LStickUp,
+    LStickDown  = ImGuiNavInput_LStickDown,
+    FocusPrev   = ImGuiNavInput_FocusPrev,
+    FocusNext   = ImGuiNavInput_FocusNext,
+    TweakSlow   = ImGuiNavInput_TweakSlow,
+    TweakFast   = ImGuiNavInput_TweakFast,
+  };
+
+  // ----------------------------------------
+  // MouseCursor
+
+  /// ImGuiMouseCursor
+  enum class MouseCursor : int {
+    None       = ImGuiMouseCursor_None,
+    Arrow      = ImGuiMouseCursor_Arrow,
+    TextInput  = ImGuiMouseCursor_TextInput,
+    ResizeAll  = ImGuiMouseCursor_ResizeAll,
+    ResizeNS   = ImGuiMouseCursor_ResizeNS,
+    ResizeEW   = ImGuiMouseCursor_ResizeEW,
+    ResizeNESW = ImGuiMouseCursor_ResizeNESW,
+    ResizeNWSE = ImGuiMouseCursor_ResizeNWSE,
+    Hand       = ImGuiMouseCursor_Hand,
+  };
+  inline MouseCursor GetMouseCursor([[maybe_unused]] MouseCursor dummy) {
+    return static_cast<MouseCursor>(ImGui::GetMouseCursor());
+  }
+  inline void SetMouseCursor(MouseCursor type) {
+    return ImGui::SetMouseCursor(static_cast<ImGuiMouseCursor>(type));
+  }
+
+  // ----------------------------------------
+  // ConfigFlags
+
+  /// ImGuiConfigFlags
+  enum class ConfigFlags : int {
+    NavEnableKeyboard    = ImGuiConfigFlags_NavEnableKeyboard,
+    NavEnableGamepad     = ImGuiConfigFlags_NavEnableGamepad,
+    NavEnableSetMousePos = ImGuiConfigFlags_NavEnableSetMousePos,
+    NavNoCaptureKeyboard = ImGuiConfigFlags_NavNoCaptureKeyboard,
+    NoMouse              = ImGuiConfigFlags_NoMouse,
+    NoMouseCursorChange  = ImGuiConfigFlags_NoMouseCursorChange,
+
+    IsSRGB        = ImGuiConfigFlags_IsSRGB,
+    IsTouchScreen = ImGuiConfigFlags_IsTouchScreen,
+  };
+
+  template <>
+  struct ec_detail::is_enum_flag<ConfigFlags> : std::true_type {};
+
+  // ----------------------------------------
+  // BackendFlags
+
+  /// ImGuiBackendFlags
+  enum class BackendFlags : int {
+    HasGamepad      = ImGuiBackendFlags_HasGamepad,
+    HasMouseCursors = ImGuiBackendFlags_HasMouseCursors,
+    HasSetMousePos  = ImGuiBackendFlags_HasSetMousePos,
+  };
+
+  template <>
+  struct ec_detail::is_enum_flag<BackendFlags> : std::true_type {};
+
+  // ----------------------------------------
+  // DataType
+
+  /// ImGuiDataType
+  enum class DataType : int {
+    S32    = ImGuiDataType_S32,
+    U32    = ImGuiDataType_U32,
+    S64    = ImGuiDataType_S64,
+    U64    = ImGuiDataType_U64,
+    Float  = ImGuiDataType_Float,
+    Double = ImGuiDataType_Double,
+  };
+
+  namespace ec_detail {
+    /// ImGuiDataType of scalar type T, or -1
+    template <class T>
+    constexpr int data_type_index() {
+      if constexpr (std::is_same_v<T, float>)
+        return ImGuiDataType_Float;
+      else if constexpr (std::is_same_v<T, double>)
+        return ImGuiDataType_Double;
+      else if constexpr (!std::is_integral_v<T> || std::is_same_v<T, bool>)
+        return -1;
+      else if constexpr (sizeof(T) == 4)
+        return std::is_signed_v<T> ? ImGuiDataType_S32 : ImGuiDataType_U32;
+      else if constexpr (sizeof(T) == 8)
+        return std::is_signed_v<T> ? ImGuiDataType_S64 : ImGuiDataType_U64;
+      else
+        return -1;
+    }
+
+    /// disables deduction from an argument
+    template <class T>
+    struct type_identity {
+      using type = T;
+    };
+    template <class T>
+    using type_identity_t = typename type_identity<T>::type;
+
+    /// T of a T* argument, void for anything else (arrays included)
+    template <class P>
+    struct pointee {
+      using type = void;
+    };
+    template <class T>
+    struct pointee<T*> {
+      using type = T;
+    };
+    template <class P>
+    using pointee_t =
+      typename pointee<std::remove_cv_t<std::remove_reference_t<P>>>::type;
+
+    /// T can be passed as DataType
+    template <class T>
+    static constexpr bool is_data_type_v = data_type_index<T>() != -1;
+
+    /// DataType of T
+    template <class T>
+    static constexpr DataType data_type_v =
+      static_cast<DataType>(data_type_index<T>());
+
+    /// default format of T
+    template <class T>
+    constexpr const char* data_type_format() {
+      switch (data_type_index<T>()) {
+        case ImGuiDataType_S32:
+          return "%d";
+        case ImGuiDataType_U32:
+          return "%u";
+#if defined(_MSC_VER)
+        case ImGuiDataType_S64:
+          return "%I64d";
+        case ImGuiDataType_U64:
+          return "%I64u";
+#else
+        case ImGuiDataType_S64:
+          return "%lld";
+        case ImGuiDataType_U64:
+          return "%llu";
+#endif
+        case ImGuiDataType_Float:
+          return "%.3f";
+        default:
+          return "%.6f";
+      }
+    }
+  } // namespace ec_detail
+
+  inline bool DragScalar(
+    const char* label,
+    DataType data_type,
+    void* v,
+    float v_speed,
+    const void* v_min  = NULL,
+    const void* v_max  = NULL,
+    const char* format = NULL,
+    float power        = 1.0f) {
+    return ImGui::DragScalar(
+      label, static_cast<ImGuiDataType>(data_type), v, v_speed, v_min, v_max,
+      format, power);
+  }
+  inline bool DragScalarN(
+    const char* label,
+    DataType data_type,
+    void* v,
+    int components,
+    float v_speed,
+    const void* v_min  = NULL,
+    const void* v_max  = NULL,
+    const char* format = NULL,
+    float power        = 1.0f) {
+    return ImGui::DragScalarN(
+      label, static_cast<ImGuiDataType>(data_type), v, components, v_speed,
+      v_min, v_max, format, power);
+  }
+  inline bool SliderScalar(
+    const char* label,
+    DataType data_type,
+    void* v,
+    const void* v_min,
+    const void* v_max,
+    const char* format = NULL,
+    float power        = 1.0f) {
+    return ImGui::SliderScalar(
+      label, static_cast<ImGuiDataType>(data_type), v, v_min, v_max, format,
+      power);
+  }
+  inline bool SliderScalarN(
+    const char* label,
+    DataType data_type,
+    void* v,
+    int components,
+    const void* v_min,
+    const void* v_max,
+    const char* format = NULL,
+    float power        = 1.0f) {
+    return ImGui::SliderScalarN(
+      label, static_cast<ImGuiDataType>(data_type), v, components, v_min, v_max,
+      format, power);
+  }
+  inline bool VSliderScalar(
+    const char* label,
+    const ImVec2& size,
+    DataType data_type,
+    void* v,
+    const void* v_min,
+    const void* v_max,
+    const char* format = NULL,
+    float power        = 1.0f) {
+    return ImGui::VSliderScalar(
+      label, size, static_cast<ImGuiDataType>(data_type), v, v_min, v_max,
+      format, power);
+  }
+
+  // DataType deduced from T.
+  // v_min == v_max means no clamping for Drag*.
+
+  template <
+    class T,
+    std::enable_if_t<ec_detail::is_data_type_v<T>, std::nullptr_t> = nullptr>
+  inline bool DragScalar(
+    const char* label,
+    T* v,
+    float v_speed,
+    ec_detail::type_identity_t<T> v_min = T(),
+    ec_detail::type_identity_t<T> v_max = T(),
+    const char* format                  = ec_detail::data_type_format<T>(),
+    float power                         = 1.0f) {
+    return ImGui::DragScalar(
+      label, ec_detail::data_type_index<T>(), v, v_speed, &v_min, &v_max,
+      format, power);
+  }
+  // v is taken as P&& so that arrays don't decay to T* and take the
+  // T (&)[N] overload below
+  template <
+    class P,
+    class T = ec_detail::pointee_t<P>,
+    std::enable_if_t<ec_detail::is_data_type_v<T>, std::nullptr_t> = nullptr>
+  inline bool DragScalarN(
+    const char* label,
+    P&& v,
+    int components,
+    float v_speed,
+    ec_detail::type_identity_t<T> v_min = T(),
+    ec_detail::type_identity_t<T> v_max = T(),
+    const char* format                  = ec_detail::data_type_format<T>(),
+    float power                         = 1.0f) {
+    return ImGui::DragScalarN(
+      label, ec_detail::data_type_index<T>(), v, components, v_speed, &v_min,
+      &v_max, format, power);
+  }
+  template <
+    class T,
+    int N,
+    std::enable_if_t<ec_detail::is_data_type_v<T>, std::nullptr_t> = nullptr>
+  inline bool DragScalarN(
+    const char* label,
+    T (&v)[N],
+    float v_speed,
+    ec_detail::type_identity_t<T> v_min = T(),
+    ec_detail::type_identity_t<T> v_max = T(),
+    const char* format                  = ec_detail::data_type_format<T>(),
+    float power                         = 1.0f) {
+    return ImGui::DragScalarN(
+      label, ec_detail::data_type_index<T>(), v, N, v_speed, &v_min, &v_max,
+      format, power);
+  }
+  template <
+    class T,
+    std::enable_if_t<ec_detail::is_data_type_v<T>, std::nullptr_t> = nullptr>
+  inline bool SliderScalar(
+    const char* label,
+    T* v,
+    ec_detail::type_identity_t<T> v_min,
+    ec_detail::type_identity_t<T> v_max,
+    const char* format = ec_detail::data_type_format<T>(),
+    float power        = 1.0f) {
+    return ImGui::SliderScalar(
+      label, ec_detail::data_type_index<T>(), v, &v_min, &v_max, format,
+      power);
+  }
+  // v is taken as P&& so that arrays don't decay to T* and take the
+  // T (&)[N] overload below
+  template <
+    class P,
+    class T = ec_detail::pointee_t<P>,
+    std::enable_if_t<ec_detail::is_data_type_v<T>, std::nullptr_t> = nullptr>
+  inline bool SliderScalarN(
+    const char* label,
+    P&& v,
+    int components,
+    ec_detail::type_identity_t<T> v_min,
+    ec_detail::type_identity_t<T> v_max,
+    const char* format = ec_detail::data_type_format<T>(),
+    float power        = 1.0f) {
+    return ImGui::SliderScalarN(
+      label, ec_detail::data_type_index<T>(), v, components, &v_min, &v_max,
+      format, power);
+  }
+  template <
+    class T,
+    int N,
+    std::enable_if_t<ec_detail::is_data_type_v<T>, std::nullptr_t> = nullptr>
+  inline bool SliderScalarN(
+    const char* label,
+    T (&v)[N],
+    ec_detail::type_identity_t<T> v_min,
+    ec_detail::type_identity_t<T> v_max,
+    const char* format = ec_detail::data_type_format<T>(),
+    float power        = 1.0f) {
+    return ImGui::SliderScalarN(
+      label, ec_detail::data_type_index<T>(), v, N, &v_min, &v_max, format,
+      power);
+  }
+  template <
+    class T,
+    std::enable_if_t<ec_detail::is_data_type_v<T>, std::nullptr_t> = nullptr>
+  inline bool VSliderScalar(
+    const char* label,
+    const ImVec2& size,
+    T* v,
+    ec_detail::type_identity_t<T> v_min,
+    ec_detail::type_identity_t<T> v_max,
+    const char* format = ec_detail::data_type_format<T>(),
+    float power        = 1.0f) {
+    return ImGui::VSliderScalar(
+      label, size, ec_detail::data_type_index<T>(), v, &v_min, &v_max, format,
+      power);
+  }
+
+  // ----------------------------------------
+  // InputTextFlags
+
+  /// ImGuiInputTextFlags
+  enum class InputTextFlags : int {
+    None                = ImGuiInputTextFlags_None,
+    CharsDecimal        = ImGuiInputTextFlags_CharsDecimal,
+    CharsHexadecimal    = ImGuiInputTextFlags_CharsHexadecimal,
+    CharsUppercase      = ImGuiInputTextFlags_CharsUppercase,
+    CharsNoBlank        = ImGuiInputTextFlags_CharsNoBlank,
+    AutoSelectAll       = ImGuiInputTextFlags_AutoSelectAll,
+    EnterReturnsTure    = ImGuiInputTextFlags_EnterReturnsTrue,
+    CallbackCompletion  = ImGuiInputTextFlags_CallbackCompletion,
+    CallbackHistory     = ImGuiInputTextFlags_CallbackHistory,
+    CallbackAlways      = ImGuiInputTextFlags_CallbackAlways,
+    CallbackCharFilter  = ImGuiInputTextFlags_CallbackCharFilter,
+    AllowTabInput       = ImGuiInputTextFlags_AllowTabInput,
+    CtrlEnterForNewLine = ImGuiInputTextFlags_CtrlEnterForNewLine,
+    NoHorizontalScroll  = ImGuiInputTextFlags_NoHorizontalScroll,
+    AlwaysInsertMode    = ImGuiInputTextFlags_AlwaysInsertMode,
+    ReadOnly            = ImGuiInputTextFlags_ReadOnly,
+    Password            = ImGuiInputTextFlags_Password,
+    NoUndoRedo          = ImGuiInputTextFlags_NoUndoRedo,
+    CharsScientific     = ImGuiInputTextFlags_CharsScientific,
+    CallbackResize      = ImGuiInputTextFlags_CallbackResize,
+  };
+
+  template <>
+  struct ec_detail::is_enum_flag<InputTextFlags> : std::true_type {};
+
+  namespace ec_detail {
+    /// false when flags contradict each other
+    constexpr bool check_input_chars_flags(InputTextFlags flags) {
+      // one character filter at a time
+      return !has_many(
+        flags,
+        InputTextFlags::CharsDecimal | InputTextFlags::CharsHexadecimal |
+          InputTextFlags::CharsScientific);
+    }
+    /// false when flags contradict each other or are multiline only
+    constexpr bool check_input_text_flags(InputTextFlags flags) {
+      return check_input_chars_flags(flags) &&
+             !has_any(
+               flags,
+               InputTextFlags::AllowTabInput |
+                 InputTextFlags::CtrlEnterForNewLine);
+    }
+    /// false when flags contradict each other or are single line only
+    constexpr bool check_input_text_multiline_flags(InputTextFlags flags) {
+      return check_input_chars_flags(flags) &&
+             !has_any(
+               flags,
+               InputTextFlags::CallbackHistory | InputTextFlags::Password) &&
+             !(has_any(flags, InputTextFlags::CallbackCompletion) &&
+               has_any(flags, InputTextFlags::AllowTabInput));
+    }
+  } // namespace ec_detail
+
+  inline bool InputText(
+    const char* label,
+    char* buf,
+    size_t buf_size,
+    InputTextFlags flags,
+    ImGuiInputTextCallback callback = NULL,
+    void* user_data                 = NULL) {
+    IMGUI_EC_HOOK("InputText");
+    IMGUI_EC_CHECK_FLAGS(ec_detail::check_input_text_flags(flags));
+    return ImGui::InputText(
+      label, buf, buf_size, static_cast<ImGuiInputTextFlags>(flags), callback,
+      user_data);
+  }
+
+  inline bool InputTextMultiline(
+    const char* label,
+    char* buf,
+    size_t buf_size,
+    const ImVec2& size,
+    InputTextFlags flags,
+    ImGuiInputTextCallback callback = NULL,
+    void* user_data                 = NULL) {
+    IMGUI_EC_HOOK("InputTextMultiline");
+    IMGUI_EC_CHECK_FLAGS(ec_detail::check_input_text_multiline_flags(flags));
+    return ImGui::InputTextMultiline(
+      label, buf, buf_size, size, static_cast<ImGuiInputTextFlags>(flags),
+      callback, user_data);
+  }
+
+  // flags as template argument are checked at compile time
+
+  template <InputTextFlags Flags>
+  inline bool InputText(
+    const char* label,
+    char* buf,
+    size_t buf_size,
+    ImGuiInputTextCallback callback = NULL,
+    void* user_data                 = NULL) {
+    IMGUI_EC_HOOK("InputText");
+    static_assert(
+      ec_detail::check_input_text_flags(Flags), "conflicting InputTextFlags");
+    return ImGui::InputText(
+      label, buf, buf_size, static_cast<ImGuiInputTextFlags>(Flags), callback,
+      user_data);
+  }
+
+  template <InputTextFlags Flags>
+  inline bool InputTextMultiline(
+    const char* label,
+    char* buf,
+    size_t buf_size,
+    const ImVec2& size              = ImVec2(0, 0),
+    ImGuiInputTextCallback callback = NULL,
+    void* user_data                 = NULL) {
+    IMGUI_EC_HOOK("InputTextMultiline");
+    static_assert(
+      ec_detail::check_input_text_multiline_flags(Flags),
+      "conflicting InputTextFlags");
+    return ImGui::InputTextMultiline(
+      label, buf, buf_size, size, static_cast<ImGuiInputTextFlags>(Flags),
+      callback, user_data);
+  }
+
+  // Growable strings: any S with char* data(), c_str(), size() and
+  // resize(n) (std::string, std::pmr::string). c_str() stands for the
+  // guarantee that data() is never null and data()[capacity()] is a
+  // terminator, which ImGui writes; containers without it such as
+  // std::vector<char> are not accepted.
+  // ImGui edits data() in place and resizes it through CallbackResize.
+
+  namespace ec_detail {
+    template <class S, class = void>
+    struct is_resizable_string : std::false_type {};
+    template <class S>
+    struct is_resizable_string<
+      S,
+      std::void_t<
+        decltype(std::declval<S&>().resize(size_t())),
+        decltype(std::declval<S&>().size()),
+        decltype(std::declval<S&>().c_str())>>
+      : std::is_same<decltype(std::declval<S&>().data()), char*> {};
+
+    /// alias
+    template <class S>
+    static constexpr bool is_resizable_string_v = is_resizable_string<S>::value;
+
+    template <class S, class = void>
+    struct has_capacity : std::false_type {};
+    template <class S>
+    struct has_capacity<S, std::void_t<decltype(std::declval<S&>().capacity())>>
+      : std::true_type {};
+
+    /// writable bytes of str including the terminator
+    template <class S>
+    size_t string_buffer_size(S& str) {
+      if constexpr (has_capacity<S>::value)
+        return static_cast<size_t>(str.capacity()) + 1;
+      else
+        return static_cast<size_t>(str.size()) + 1;
+    }
+
+    template <class S>
+    struct input_text_string_data {
+      S* str;
+      ImGuiInputTextCallback chain_callback;
+      void* chain_user_data;
+    };
+
+    /// resizes the string, forwards other events to the user callback
+    template <class S>
+    int input_text_string_callback(ImGuiInputTextCallbackData* data) {
+      auto* d = static_cast<input_text_string_data<S>*>(data->UserData);
+      if (data->EventFlag == ImGuiInputTextFlags_CallbackResize) {
+        IM_ASSERT(data->Buf == d->str->data());
+        d->str->resize(static_cast<size_t>(data->BufTextLen));
+        data->Buf = d->str->data();
+        return 0;
+      }
+      if (!d->chain_callback)
+        return 0;
+      data->UserData = d->chain_user_data;
+      return d->chain_callback(data);
+    }
+  } // namespace ec_detail
+
+  template <
+    class S,
+    std::enable_if_t<ec_detail::is_resizable_string_v<S>, std::nullptr_t> =
+      nullptr>
+  inline bool InputText(
+    const char* label,
+    S* str,
+    InputTextFlags flags            = InputTextFlags::None,
+    ImGuiInputTextCallback callback = NULL,
+    void* user_data                 = NULL) {
+    IMGUI_EC_HOOK("InputText");
+    IMGUI_EC_CHECK_FLAGS(ec_detail::check_input_text_flags(flags));
+    IM_ASSERT(!ec_detail::has_any(flags, InputTextFlags::CallbackResize));
+    ec_detail::input_text_string_data<S> data {str, callback, user_data};
+    return ImGui::InputText(
+      label, str->data(), ec_detail::string_buffer_size(*str),
+      static_cast<ImGuiInputTextFlags>(flags | InputTextFlags::CallbackResize),
+      ec_detail::input_text_string_callback<S>, &data);
+  }
+
+  template <
+    class S,
+    std::enable_if_t<ec_detail::is_resizable_string_v<S>, std::nullptr_t> =
+      nullptr>
+  inline bool InputTextMultiline(
+    const char* label,
+    S* str,
+    const ImVec2& size              = ImVec2(0, 0),
+    InputTextFlags flags            = InputTextFlags::None,
+    ImGuiInputTextCallback callback = NULL,
+    void* user_data                 = NULL) {
+    IMGUI_EC_HOOK("InputTextMultiline");
+    IMGUI_EC_CHECK_FLAGS(ec_detail::check_input_text_multiline_flags(flags));
+    IM_ASSERT(!ec_detail::has_any(flags, InputTextFlags::CallbackResize));
+    ec_detail::input_text_string_data<S> data {str, callback, user_data};
+    return ImGui::InputTextMultiline(
+      label, str->data(), ec_detail::string_buffer_size(*str), size,
+      static_cast<ImGuiInputTextFlags>(flags | InputTextFlags::CallbackResize),
+      ec_detail::input_text_string_callback<S>, &data);
+  }
+
+  inline bool InputFloat(
+    const char* label,
+    float* v,
+    float step,
+    float step_fast,
+    const char* format,
+    InputTextFlags extra_flags) {
+    return ImGui::InputFloat(
+      label, v, step, step_fast, format,
+      static_cast<ImGuiInputTextFlags>(extra_flags));
+  }
+
+  inline bool InputFloat2(
+    const char* label,
+    float v[2],
+    const char* format,
+    InputTextFlags extra_flags) {
+    return ImGui::InputFloat2(
+      label, v, format, static_cast<ImGuiInputTextFlags>(extra_flags));
+  }
+
+  inline bool InputFloat3(
+    const char* label,
+    float v[3],
+    const char* format,
+    InputTextFlags extra_flags) {
+    return ImGui::InputFloat3(
+      label, v, format, static_cast<ImGuiInputTextFlags>(extra_flags));
+  }
+
+  inline bool InputFloat4(
+    const char* label,
+    float v[4],
+    const char* format,
+    InputTextFlags extra_flags) {
+    return ImGui::InputFloat4(
+      label, v, format, static_cast<ImGuiInputTextFlags>(extra_flags));
+  }
+
+  inline bool InputInt(
+    const char* label,
+    int* v,
+    int step,
+    int step_fast,
+    InputTextFlags extra_flags) {
+    return ImGui::InputInt(
+      label, v, step, step_fast, static_cast<ImGuiInputTextFlags>(extra_flags));
+  }
+
+  inline bool InputInt2(
+    const char* label, int v[2], InputTextFlags extra_flags) {
+    return ImGui::InputInt2(
+      label, v, static_cast<ImGuiInputTextFlags>(extra_flags));
+  }
+
+  inline bool InputInt3(
+    const char* label, int v[3], InputTextFlags extra_flags) {
+    return ImGui::InputInt3(
+      label, v, static_cast<ImGuiInputTextFlags>(extra_flags));
+  }
+
+  inline bool InputInt4(
+    const char* label, int v[4], InputTextFlags extra_flags) {
+    return ImGui::InputInt4(
+      label, v, static_cast<ImGuiInputTextFlags>(extra_flags));
+  }
+
+  inline bool InputDouble(
+    const char* label,
+    double* v,
+    double step,
+    double step_fast,
+    const char* format,
+    InputTextFlags extra_flags) {
+    return ImGui::InputDouble(
+      label, v, step, step_fast, format,
+      static_cast<ImGuiInputTextFlags>(extra_flags));
+  }
+
+  inline bool InputScalar(
+    const char* label,
+    DataType data_type,
+    void* v,
+    const void* step,
+    const void* step_fast,
+    const char* format,
+    InputTextFlags extra_flags) {
+    return ImGui::InputScalar(
+      label, static_cast<ImGuiDataType>(data_type), v, step, step_fast, format,
+      static_cast<ImGuiInputTextFlags>(extra_flags));
+  }
+  inline bool InputScalarN(
+    const char* label,
+    DataType data_type,
+    void* v,
+    int components,
+    const void* step,
+    const void* step_fast,
+    const char* format,
+    InputTextFlags extra_flags) {
+    return ImGui::InputScalarN(
+      label, static_cast<ImGuiDataType>(data_type), v, components, step,
+      step_fast, format, static_cast<ImGuiInputTextFlags>(extra_flags));
+  }
+
+  // DataType deduced from T.
+  // step == 0 hides the +/- buttons.
+
+  template <
+    class T,
+    std::enable_if_t<ec_detail::is_data_type_v<T>, std::nullptr_t> = nullptr>
+  inline bool InputScalar(
+    const char* label,
+    T* v,
+    ec_detail::type_identity_t<T> step      = T(),
+    ec_detail::type_identity_t<T> step_fast = T(),
+    const char* format                      = ec_detail::data_type_format<T>(),
+    InputTextFlags extra_flags              = InputTextFlags::None) {
+    return ImGui::InputScalar(
+      label, ec_detail::data_type_index<T>(), v,
+      step != T() ? &step : NULL, step_fast != T() ? &step_fast : NULL,
+      format, static_cast<ImGuiInputTextFlags>(extra_flags));
+  }
+  // v is taken as P&& so that arrays don't decay to T* and take the
+  // T (&)[N] overload below
+  template <
+    class P,
+    class T = ec_detail::pointee_t<P>,
+    std::enable_if_t<ec_detail::is_data_type_v<T>, std::nullptr_t> = nullptr>
+  inline bool InputScalarN(
+    const char* label,
+    P&& v,
+    int components,
+    ec_detail::type_identity_t<T> step      = T(),
+    ec_detail::type_identity_t<T> step_fast = T(),
+    const char* format                      = ec_detail::data_type_format<T>(),
+    InputTextFlags extra_flags              = InputTextFlags::None) {
+    return ImGui::InputScalarN(
+      label, ec_detail::data_type_index<T>(), v, components,
+      step != T() ? &step : NULL, step_fast != T() ? &step_fast : NULL,
+      format, static_cast<ImGuiInputTextFlags>(extra_flags));
+  }
+  template <
+    class T,
+    int N,
+    std::enable_if_t<ec_detail::is_data_type_v<T>, std::nullptr_t> = nullptr>
+  inline bool InputScalarN(
+    const char* label,
+    T (&v)[N],
+    ec_detail::type_identity_t<T> step      = T(),
+    ec_detail::type_identity_t<T> step_fast = T(),
+    const char* format                      = ec_detail::data_type_format<T>(),
+    InputTextFlags extra_flags              = InputTextFlags::None) {
+    return ImGui::InputScalarN(
+      label, ec_detail::data_type_index<T>(), v, N,
+      step != T() ? &step : NULL, step_fast != T() ? &step_fast : NULL,
+      format, static_cast<ImGuiInputTextFlags>(extra_flags));
+  }
+
+} // namespace ImGui
@@ -0,0 +1,344 @@
+#pragma once
+
+#include "Input.hpp"
+
+#include <float.h>  // FLT_MAX
+#include <stddef.h> // size_t
+#include <stdio.h>  // FILE, fwrite
+#include <string.h> // memcpy, memset
+
+namespace ImGui {
+
+  namespace ec_detail {
+
+    enum class input_event_type : unsigned char {
+      frame,        // x: DeltaTime
+      display_size, // x, y
+      mouse_pos,    // x, y
+      mouse_button, // index: button, aux: down
+      mouse_wheel,  // x: MouseWheel, y: MouseWheelH
+      key,          // index: Key, aux: down
+      raw_key,      // index: down, aux: KeysDown index without a Key
+      modifiers,    // index: ctrl | shift << 1 | alt << 2 | super << 3
+      nav_input,    // index: NavInput, x: value
+      character,    // aux: ImWchar
+      cursor,       // index: MouseCursor + 1 at the end of the frame
+    };
+
+    /// fixed size record of the log
+    struct input_event {
+      input_event_type type;
+      unsigned char index;
+      unsigned short aux;
+      float x;
+      float y;
+    };
+    static_assert(sizeof(input_event) == 12, "input_event should be packed");
+
+    constexpr ImU32 input_log_magic   = 0x52494345; // "ECIR"
+    constexpr ImU32 input_log_version = 1;
+
+    inline unsigned char modifier_bits(const ImGuiIO& io) {
+      return static_cast<unsigned char>(
+        (io.KeyCtrl ? 1 : 0) | (io.KeyShift ? 2 : 0) | (io.KeyAlt ? 4 : 0) |
+        (io.KeySuper ? 8 : 0));
+    }
+
+  } // namespace ec_detail
+
+  /// Records the input fed to ImGuiIO as a compact binary log.
+  /// Keys which have a Key are stored as Key, so a log replays through the
+  /// KeyMap of another backend. Events are buffered in a fixed chunk which
+  /// is handed to the sink when full, so recording never allocates.
+  /// ```
+  /// FILE* f = fopen("session.ecir", "wb");
+  /// ImGui::InputRecorder recorder(ImGui::InputRecorder::FileSink, f);
+  /// // every frame, after the backend filled io
+  /// recorder.NewFrame(ImGui::GetIO());
+  /// ImGui::NewFrame();
+  /// ...
+  /// ImGui::Render();
+  /// recorder.EndFrame();
+  /// ```
+  class InputRecorder {
+  public:
+    using Sink = void (*)(const void* data, size_t size, void* user_data);
+
+    /// sink for a FILE* passed as user_data
+    static void FileSink(const void* data, size_t size, void* user_data) {
+      fwrite(data, 1, size, static_cast<FILE*>(user_data));
+    }
+
+    InputRecorder(Sink sink, void* user_data)
+      : m_sink(sink)
+      , m_user_data(user_data)
+      , m_count(0) {
+      const ImU32 header[3] = {
+        ec_detail::input_log_magic, ec_detail::input_log_version,
+        sizeof(ec_detail::input_event)};
+      m_sink(header, sizeof(header), m_user_data);
+
+      // state replay starts from
+      m_display_size = ImVec2(-1, -1);
+      m_mouse_pos    = ImVec2(-FLT_MAX, -FLT_MAX);
+      m_modifiers    = 0;
+      memset(m_mouse_down, 0, sizeof(m_mouse_down));
+      memset(m_keys_down, 0, sizeof(m_keys_down));
+    }
+    ~InputRecorder() {
+      Flush();
+    }
+
+    InputRecorder(const InputRecorder&) = delete;
+    InputRecorder& operator=(const InputRecorder&) = delete;
+
+    /// Records the changes of io since the last frame. Call it after the
+    /// backend updated io and before ImGui::NewFrame().
+    void NewFrame(const ImGuiIO& io) {
+      using type = ec_detail::input_event_type;
+      Push(type::frame, 0, 0, io.DeltaTime);
+
+      if (
+        io.DisplaySize.x != m_display_size.x ||
+        io.DisplaySize.y != m_display_size.y) {
+        m_display_size = io.DisplaySize;
+        Push(type::display_size, 0, 0, io.DisplaySize.x, io.DisplaySize.y);
+      }
+      if (io.MousePos.x != m_mouse_pos.x || io.MousePos.y != m_mouse_pos.y) {
+        m_mouse_pos = io.MousePos;
+        Push(type::mouse_pos, 0, 0, io.MousePos.x, io.MousePos.y);
+      }
+      for (int i = 0; i < IM_ARRAYSIZE(m_mouse_down); ++i) {
+        if (io.MouseDown[i] != m_mouse_down[i]) {
+          m_mouse_down[i] = io.MouseDown[i];
+          Push(
+            type::mouse_button, static_cast<unsigned char>(i),
+            io.MouseDown[i]);
+        }
+      }
+      if (io.MouseWheel != 0 || io.MouseWheelH != 0)
+        Push(type::mouse_wheel, 0, 0, io.MouseWheel, io.MouseWheelH);
+
+      const unsigned char modifiers = ec_detail::modifier_bits(io);
+      if (modifiers != m_modifiers) {
+        m_modifiers = modifiers;
+        Push(type::modifiers, modifiers, 0);
+      }
+
+      // KeysDown index -> Key
+      signed char named[IM_ARRAYSIZE(m_keys_down)];
+      memset(named, -1, sizeof(named));
+      for (int k = 0; k < ImGuiKey_COUNT; ++k) {
+        const int index = io.KeyMap[k];
+        if (index >= 0 && index < IM_ARRAYSIZE(named))
+          named[index] = static_cast<signed char>(k);
+      }
+      for (int i = 0; i < IM_ARRAYSIZE(m_keys_down); ++i) {
+        if (io.KeysDown[i] == m_keys_down[i])
+          continue;
+        m_keys_down[i] = io.KeysDown[i];
+        if (named[i] >= 0)
+          Push(type::key, static_cast<unsigned char>(named[i]), io.KeysDown[i]);
+        else
+          Push(type::raw_key, io.KeysDown[i], static_cast<unsigned short>(i));
+      }
+
+      // backends write NavInputs every frame, so store what is set
+      for (int i = 0; i < ImGuiNavInput_InternalStart_; ++i)
+        if (io.NavInputs[i] != 0)
+          Push(
+            type::nav_input, static_cast<unsigned char>(i), 0,
+            io.NavInputs[i]);
+
+      for (int i = 0; i < IM_ARRAYSIZE(io.InputCharacters); ++i) {
+        if (io.InputCharacters[i] == 0)
+          break;
+        Push(type::character, 0, io.InputCharacters[i]);
+      }
+    }
+
+    /// Records the mouse cursor requested by the frame, which replay uses to
+    /// detect a diverging session. Call it after ImGui::Render().
+    void EndFrame() {
+      const MouseCursor cursor = GetMouseCursor(MouseCursor{});
+      Push(
+        ec_detail::input_event_type::cursor,
+        static_cast<unsigned char>(static_cast<int>(cursor) + 1), 0);
+    }
+
+    /// hands the buffered events to the sink
+    void Flush() {
+      if (m_count == 0)
+        return;
+      m_sink(m_events, m_count * sizeof(m_events[0]), m_user_data);
+      m_count = 0;
+    }
+
+  private:
+    void Push(
+      ec_detail::input_event_type type,
+      unsigned char index,
+      unsigned short aux,
+      float x = 0,
+      float y = 0) {
+      if (m_count == IM_ARRAYSIZE(m_events))
+        Flush();
+      ec_detail::input_event& e = m_events[m_count++];
+      e.type                    = type;
+      e.index                   = index;
+      e.aux                     = aux;
+      e.x                       = x;
+      e.y                       = y;
+    }
+
+    Sink m_sink;
+    void* m_user_data;
+    int m_count;
+    ec_detail::input_event m_events[340]; // ~4KB
+
+    ImVec2 m_display_size;
+    ImVec2 m_mouse_pos;
+    unsigned char m_modifiers;
+    bool m_mouse_down[5];
+    bool m_keys_down[512];
+  };
+
+  /// Replays a log written by InputRecorder into ImGuiIO, frame by frame.
+  /// The log is read in place, so it can be a memory-mapped file. The
+  /// backend should not feed io while replaying.
+  /// ```
+  /// ImGui::InputReplayer replayer(data, size);
+  /// while (replayer.NewFrame(ImGui::GetIO())) {
+  ///   ImGui::NewFrame();
+  ///   ...
+  ///   ImGui::Render();
+  ///   if (!replayer.EndFrame())
+  ///     break; // the UI reacted differently than when recorded
+  /// }
+  /// ```
+  class InputReplayer {
+  public:
+    InputReplayer(const void* data, size_t size)
+      : m_data(static_cast<const unsigned char*>(data))
+      , m_end(m_data + size)
+      , m_pos(m_data)
+      , m_frame(0) {
+      ImU32 header[3] = {0, 0, 0};
+      if (size >= sizeof(header))
+        memcpy(header, m_data, sizeof(header));
+      if (
+        header[0] != ec_detail::input_log_magic ||
+        header[1] != ec_detail::input_log_version ||
+        header[2] != sizeof(ec_detail::input_event)) {
+        m_pos = m_end; // nothing to replay
+        return;
+      }
+      m_pos += sizeof(header);
+    }
+
+    /// Applies the input of the next frame to io. Returns false at the end
+    /// of the log.
+    bool NewFrame(ImGuiIO& io) {
+      using type = ec_detail::input_event_type;
+      ec_detail::input_event e;
+      // cursor of the previous frame, left when EndFrame() is not called
+      if (Peek(e) && e.type == type::cursor)
+        m_pos += sizeof(e);
+      if (!Peek(e) || e.type != type::frame)
+        return false;
+      m_pos += sizeof(e);
+
+      // same state as the recorder starts from
+      if (m_frame++ == 0) {
+        io.MousePos = ImVec2(-FLT_MAX, -FLT_MAX);
+        io.KeyCtrl = io.KeyShift = io.KeyAlt = io.KeySuper = false;
+        memset(io.MouseDown, 0, sizeof(io.MouseDown));
+        memset(io.KeysDown, 0, sizeof(io.KeysDown));
+      }
+      io.DeltaTime  = e.x;
+      io.MouseWheel = io.MouseWheelH = 0;
+      memset(io.NavInputs, 0, sizeof(io.NavInputs));
+      memset(io.InputCharacters, 0, sizeof(io.InputCharacters));
+
+      while (Peek(e) && e.type != type::frame && e.type != type::cursor) {
+        m_pos += sizeof(e);
+        switch (e.type) {
+          case type::display_size:
+            io.DisplaySize = ImVec2(e.x, e.y);
+            break;
+          case type::mouse_pos:
+            io.MousePos = ImVec2(e.x, e.y);
+            break;
+          case type::mouse_button:
+            if (e.index < IM_ARRAYSIZE(io.MouseDown))
+              io.MouseDown[e.index] = e.aux != 0;
+            break;
+          case type::mouse_wheel:
+            io.MouseWheel  = e.x;
+            io.MouseWheelH = e.y;
+            break;
+          case type::key: {
+            const int index =
+              e.index < ImGuiKey_COUNT ? io.KeyMap[e.index] : -1;
+            if (index >= 0 && index < IM_ARRAYSIZE(io.KeysDown))
+              io.KeysDown[index] = e.aux != 0;
+          } break;
+          case type::raw_key:
+            if (e.aux < IM_ARRAYSIZE(io.KeysDown))
+              io.KeysDown[e.aux] = e.index != 0;
+            break;
+          case type::modifiers:
+            io.KeyCtrl  = (e.index & 1) != 0;
+            io.KeyShift = (e.index & 2) != 0;
+            io.KeyAlt   = (e.index & 4) != 0;
+            io.KeySuper = (e.index & 8) != 0;
+            break;
+          case type::nav_input:
+            if (e.index < ImGuiNavInput_InternalStart_)
+              io.NavInputs[e.index] = e.x;
+            break;
+          case type::character:
+            io.AddInputCharacter(static_cast<ImWchar>(e.aux));
+            break;
+          case type::frame:
+          case type::cursor:
+            break;
+        }
+      }
+      return true;
+    }
+
+    /// Returns false when the frame requested another mouse cursor than the
+    /// recorded one. Call it after ImGui::Render(), or not at all.
+    bool EndFrame() {
+      ec_detail::input_event e;
+      if (!Peek(e) || e.type != ec_detail::input_event_type::cursor)
+        return true;
+      m_pos += sizeof(e);
+      const MouseCursor cursor = GetMouseCursor(MouseCursor{});
+      return static_cast<int>(cursor) + 1 == e.index;
+    }
+
+    /// number of frames replayed so far
+    int GetFrameCount() const {
+      return m_frame;
+    }
+    bool IsDone() const {
+      return m_pos == m_end;
+    }
+
+  private:
+    bool Peek(ec_detail::input_event& e) const {
+      if (static_cast<size_t>(m_end - m_pos) < sizeof(e))
+        return false;
+      memcpy(&e, m_pos, sizeof(e));
+      return true;
+    }
+
+    const unsigned char* m_data;
+    const unsigned char* m_end;
+    const unsigned char* m_pos;
+    int m_frame;
+  };
+
+} // namespace ImGui
@@ -0,0 +1,309 @@
+#pragma once
+
+#include "Input.hpp"
+#include "Widgets.hpp"
+
+#include <algorithm> // max, sort, lower_bound
+#include <float.h>   // FLT_MAX
+#include <math.h>    // fabsf
+#include <string.h>  // memcpy, memset
+
+namespace ImGui {
+
+  namespace ec_detail {
+    /// pressed this frame, with the typematic repeat of ImGui
+    inline bool nav_input_pressed(int n, bool repeat) {
+      const ImGuiIO& io = ImGui::GetIO();
+      const float t     = io.NavInputsDownDuration[n];
+      if (t == 0.0f)
+        return true;
+      const float delay = io.KeyRepeatDelay;
+      const float rate  = io.KeyRepeatRate;
+      if (!repeat || t <= delay || rate <= 0.0f)
+        return false;
+      const float t_prev = t - io.DeltaTime;
+      return static_cast<int>((t - delay) / rate) >
+             static_cast<int>((t_prev - delay) / rate);
+    }
+
+    /// signed gap from [b0, b1] to [a0, a1], 0 when they overlap
+    inline float interval_gap(float a0, float a1, float b0, float b1) {
+      if (a1 < b0)
+        return a1 - b0;
+      if (b1 < a0)
+        return a0 - b1;
+      return 0.0f;
+    }
+
+    inline Dir dir_of_delta(float dx, float dy) {
+      if (fabsf(dx) > fabsf(dy))
+        return dx > 0 ? Dir::Right : Dir::Left;
+      return dy > 0 ? Dir::Down : Dir::Up;
+    }
+  } // namespace ec_detail
+
+  inline bool IsNavInputPressed(NavInput n, bool repeat = true) {
+    return ec_detail::nav_input_pressed(static_cast<int>(n), repeat);
+  }
+
+  /// Direction requested by the D-pad, left stick or (with
+  /// ConfigFlags::NavEnableKeyboard) arrow keys this frame, or Dir::None.
+  inline Dir GetNavInputDir(bool repeat = true) {
+    static const int inputs[4][3] = {
+      {static_cast<int>(NavInput::DpadLeft),
+       static_cast<int>(NavInput::LStickLeft), ImGuiNavInput_KeyLeft_},
+      {static_cast<int>(NavInput::DpadRight),
+       static_cast<int>(NavInput::LStickRight), ImGuiNavInput_KeyRight_},
+      {static_cast<int>(NavInput::DpadUp),
+       static_cast<int>(NavInput::LStickUp), ImGuiNavInput_KeyUp_},
+      {static_cast<int>(NavInput::DpadDown),
+       static_cast<int>(NavInput::LStickDown), ImGuiNavInput_KeyDown_},
+    };
+    for (int dir = 0; dir < 4; ++dir)
+      for (int n : inputs[dir])
+        if (ec_detail::nav_input_pressed(n, repeat))
+          return static_cast<Dir>(dir);
+    return Dir::None;
+  }
+
+  /// Directional navigation between many custom items (e.g. the nodes of a
+  /// canvas) through a uniform grid of their rects.
+  /// Finding the neighbour in a direction looks at the cells around the
+  /// item ring by ring and stops as soon as no closer item can follow, so a
+  /// move costs about the same for any number of items. Candidates are
+  /// scored like ImGui's own navigation: nearest rect in the quadrant of
+  /// the direction, ties broken by the distance between centers.
+  /// ```
+  /// static ImGui::NavGrid grid;
+  /// static ImGuiID current;
+  /// if (graph_changed) {
+  ///   grid.Clear();
+  ///   for (const Node& node : nodes)
+  ///     grid.Add(node.id, node.min, node.max);
+  /// }
+  /// if (ImGui::IsWindowFocused() && grid.Navigate(&current))
+  ///   ScrollToNode(current);
+  /// ```
+  class NavGrid {
+  public:
+    /// cell_size is a hint close to the size of an item, it grows for
+    /// sparse layouts
+    explicit NavGrid(float cell_size = 64.0f)
+      : m_cell_size_hint(cell_size)
+      , m_cell_size(cell_size)
+      , m_cols(0)
+      , m_rows(0)
+      , m_dirty(false) {}
+
+    void Clear() {
+      m_items.resize(0);
+      m_dirty = true;
+    }
+
+    /// adds an item with a rect in any fixed coordinates (e.g. canvas)
+    void Add(ImGuiID id, const ImVec2& min, const ImVec2& max) {
+      const Item item = {id, min, max};
+      m_items.push_back(item);
+      m_dirty = true;
+    }
+
+    int GetSize() const {
+      return m_items.Size;
+    }
+
+    bool GetItemRect(ImGuiID id, ImVec2* min, ImVec2* max) {
+      const int i = IndexOf(id);
+      if (i < 0)
+        return false;
+      *min = m_items[i].min;
+      *max = m_items[i].max;
+      return true;
+    }
+
+    /// nearest item from id in dir, 0 when there is none
+    ImGuiID Find(ImGuiID id, Dir dir) {
+      const int i = IndexOf(id);
+      const int j = i < 0 ? -1 : FindIndex(i, dir);
+      return j < 0 ? 0 : m_items[j].id;
+    }
+
+    /// Moves *current in the direction given by GetNavInputDir(). Starts
+    /// from the first item when *current is not in the grid. Returns true
+    /// when *current changed.
+    bool Navigate(ImGuiID* current, bool repeat = true) {
+      const Dir dir = GetNavInputDir(repeat);
+      if (dir == Dir::None || m_items.empty())
+        return false;
+      const int i = IndexOf(*current);
+      const int j = i < 0 ? 0 : FindIndex(i, dir);
+      if (j < 0)
+        return false;
+      *current = m_items[j].id;
+      return true;
+    }
+
+  private:
+    struct Item {
+      ImGuiID id;
+      ImVec2 min;
+      ImVec2 max;
+    };
+    struct IdIndex {
+      ImGuiID id;
+      int index;
+      bool operator<(const IdIndex& rhs) const {
+        return id < rhs.id;
+      }
+    };
+
+    int CellX(float x) const {
+      const int c = static_cast<int>((x - m_origin.x) / m_cell_size);
+      return c < 0 ? 0 : c >= m_cols ? m_cols - 1 : c;
+    }
+    int CellY(float y) const {
+      const int c = static_cast<int>((y - m_origin.y) / m_cell_size);
+      return c < 0 ? 0 : c >= m_rows ? m_rows - 1 : c;
+    }
+
+    void Build() {
+      m_dirty = false;
+      m_cols = m_rows = 0;
+      m_cell_start.resize(0);
+      m_cell_items.resize(0);
+      m_ids.resize(m_items.Size);
+      if (m_items.empty())
+        return;
+
+      ImVec2 lo = m_items[0].min, hi = m_items[0].max;
+      for (int i = 0; i < m_items.Size; ++i) {
+        const Item& item = m_items[i];
+        lo.x             = item.min.x < lo.x ? item.min.x : lo.x;
+        lo.y             = item.min.y < lo.y ? item.min.y : lo.y;
+        hi.x             = item.max.x > hi.x ? item.max.x : hi.x;
+        hi.y             = item.max.y > hi.y ? item.max.y : hi.y;
+        m_ids[i].id      = item.id;
+        m_ids[i].index   = i;
+      }
+      std::sort(m_ids.begin(), m_ids.end());
+
+      // about one cell per item at most
+      const int max_cells = std::max(1024, m_items.Size * 4);
+      m_origin            = lo;
+      m_cell_size         = m_cell_size_hint > 0 ? m_cell_size_hint : 64.0f;
+      for (;;) {
+        m_cols = static_cast<int>((hi.x - lo.x) / m_cell_size) + 1;
+        m_rows = static_cast<int>((hi.y - lo.y) / m_cell_size) + 1;
+        if (static_cast<double>(m_cols) * m_rows <= max_cells)
+          break;
+        m_cell_size *= 2;
+      }
+
+      // items of each cell, packed
+      const int cells = m_cols * m_rows;
+      m_cell_start.resize(cells + 1);
+      memset(m_cell_start.Data, 0, (cells + 1) * sizeof(int));
+      for (const Item& item : m_items)
+        for (int y = CellY(item.min.y); y <= CellY(item.max.y); ++y)
+          for (int x = CellX(item.min.x); x <= CellX(item.max.x); ++x)
+            ++m_cell_start[y * m_cols + x + 1];
+      for (int c = 0; c < cells; ++c)
+        m_cell_start[c + 1] += m_cell_start[c];
+      m_cell_items.resize(m_cell_start[cells]);
+      ImVector<int>& fill = m_scratch;
+      fill.resize(cells);
+      memcpy(fill.Data, m_cell_start.Data, cells * sizeof(int));
+      for (int i = 0; i < m_items.Size; ++i) {
+        const Item& item = m_items[i];
+        for (int y = CellY(item.min.y); y <= CellY(item.max.y); ++y)
+          for (int x = CellX(item.min.x); x <= CellX(item.max.x); ++x)
+            m_cell_items[fill[y * m_cols + x]++] = i;
+      }
+    }
+
+    /// index of id in m_items, or -1
+    int IndexOf(ImGuiID id) {
+      if (m_dirty)
+        Build();
+      const IdIndex key = {id, 0};
+      const IdIndex* it = std::lower_bound(m_ids.begin(), m_ids.end(), key);
+      return it != m_ids.end() && it->id == id ? it->index : -1;
+    }
+
+    int FindIndex(int from, Dir dir) {
+      if (m_dirty)
+        Build();
+      const Item& cur = m_items[from];
+      const int x0 = CellX(cur.min.x), x1 = CellX(cur.max.x);
+      const int y0 = CellY(cur.min.y), y1 = CellY(cur.max.y);
+
+      int best          = -1;
+      float best_box    = FLT_MAX;
+      float best_center = FLT_MAX;
+      const int max_r   = std::max(m_cols, m_rows);
+      for (int r = 0; r <= max_r; ++r) {
+        // items first met in ring r are at least r - 1 cells away
+        if (best >= 0 && best_box < (r - 1) * m_cell_size)
+          break;
+        for (int y = y0 - r; y <= y1 + r; ++y) {
+          if (
+            y < 0 || y >= m_rows || (dir == Dir::Up && y > y1) ||
+            (dir == Dir::Down && y < y0))
+            continue;
+          const bool edge = r == 0 || y == y0 - r || y == y1 + r;
+          const int step  = edge ? 1 : x1 - x0 + 2 * r;
+          for (int x = x0 - r; x <= x1 + r; x += step) {
+            if (
+              x < 0 || x >= m_cols || (dir == Dir::Left && x > x1) ||
+              (dir == Dir::Right && x < x0))
+              continue;
+            const int c = y * m_cols + x;
+            for (int k = m_cell_start[c]; k < m_cell_start[c + 1]; ++k) {
+              const int i = m_cell_items[k];
+              if (i == from)
+                continue;
+              const Item& cand = m_items[i];
+              const float dbx  = ec_detail::interval_gap(
+                cand.min.x, cand.max.x, cur.min.x, cur.max.x);
+              const float dby = ec_detail::interval_gap(
+                cand.min.y, cand.max.y, cur.min.y, cur.max.y);
+              const float dcx =
+                (cand.min.x + cand.max.x - cur.min.x - cur.max.x) * 0.5f;
+              const float dcy =
+                (cand.min.y + cand.max.y - cur.min.y - cur.max.y) * 0.5f;
+              if (dbx == 0 && dby == 0 && dcx == 0 && dcy == 0)
+                continue;
+              const Dir quadrant = dbx != 0 || dby != 0
+                                     ? ec_detail::dir_of_delta(dbx, dby)
+                                     : ec_detail::dir_of_delta(dcx, dcy);
+              if (quadrant != dir)
+                continue;
+              const float d_box    = fabsf(dbx) + fabsf(dby);
+              const float d_center = fabsf(dcx) + fabsf(dcy);
+              if (
+                d_box < best_box ||
+                (d_box == best_box && d_center < best_center)) {
+                best        = i;
+                best_box    = d_box;
+                best_center = d_center;
+              }
+            }
+          }
+        }
+      }
+      return best;
+    }
+
+    ImVector<Item> m_items;
+    ImVector<IdIndex> m_ids;       // sorted by id
+    ImVector<int> m_cell_start;    // first entry of each cell in m_cell_items
+    ImVector<int> m_cell_items;    // item indices, cell after cell
+    ImVector<int> m_scratch;
+    ImVec2 m_origin;
+    float m_cell_size_hint;
+    float m_cell_size;
+    int m_cols;
+    int m_rows;
+    bool m_dirty;
+  };
+
+} // namespace ImGui
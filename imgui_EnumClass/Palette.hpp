@@ -0,0 +1,84 @@
+#pragma once
+
+#include "Style.hpp"
+
+#include <string.h> // memcpy
+
+namespace ImGui {
+
+  /// Complete set of style colors indexed by Col.
+  /// Keeps a packed ImU32 copy of each color next to the ImVec4 value.
+  class Palette {
+  public:
+    /// all colors are zero
+    Palette() {
+      memset(m_packed, 0, sizeof(m_packed));
+    }
+
+    /// copy colors of style
+    explicit Palette(const ImGuiStyle& style) {
+      Capture(style);
+    }
+
+    /// copy colors of style
+    void Capture(const ImGuiStyle& style) {
+      static_assert(sizeof(m_colors) == sizeof(style.Colors));
+      memcpy(m_colors, style.Colors, sizeof(m_colors));
+      for (int i = 0; i < ImGuiCol_COUNT; ++i)
+        m_packed[i] = ImGui::ColorConvertFloat4ToU32(m_colors[i]);
+    }
+
+    void Set(Col idx, const ImVec4& col) {
+      m_colors[static_cast<int>(idx)] = col;
+      m_packed[static_cast<int>(idx)] = ImGui::ColorConvertFloat4ToU32(col);
+    }
+    void Set(Col idx, ImU32 col) {
+      m_colors[static_cast<int>(idx)] = ImGui::ColorConvertU32ToFloat4(col);
+      m_packed[static_cast<int>(idx)] = col;
+    }
+
+    const ImVec4& GetVec4(Col idx) const {
+      return m_colors[static_cast<int>(idx)];
+    }
+    /// packed color (style.Alpha is not applied)
+    ImU32 GetU32(Col idx) const {
+      return m_packed[static_cast<int>(idx)];
+    }
+
+    /// overwrite colors of style with this palette in one block copy
+    void Apply(ImGuiStyle& style) const {
+      memcpy(style.Colors, m_colors, sizeof(m_colors));
+      TouchStyle();
+    }
+    /// overwrite colors of current style
+    void Apply() const {
+      Apply(ImGui::GetStyle());
+    }
+
+  private:
+    ImVec4 m_colors[ImGuiCol_COUNT];
+    ImU32 m_packed[ImGuiCol_COUNT];
+  };
+
+  /// Applies a palette to current style and restores previous colors on
+  /// destruction.
+  class PaletteScope {
+  public:
+    explicit PaletteScope(const Palette& palette) {
+      ImGuiStyle& style = ImGui::GetStyle();
+      memcpy(m_backup, style.Colors, sizeof(m_backup));
+      palette.Apply(style);
+    }
+    ~PaletteScope() {
+      memcpy(ImGui::GetStyle().Colors, m_backup, sizeof(m_backup));
+      TouchStyle();
+    }
+
+    PaletteScope(const PaletteScope&) = delete;
+    PaletteScope& operator=(const PaletteScope&) = delete;
+
+  private:
+    ImVec4 m_backup[ImGuiCol_COUNT];
+  };
+
+} // namespace ImGui
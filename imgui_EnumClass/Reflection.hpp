@@ -0,0 +1,639 @@
+#pragma once
+
+#include "Style.hpp"
+#include "Window.hpp"
+#include "Input.hpp"
+#include "DrawList.hpp"
+#include "Widgets.hpp"
+
+#include <array>
+#include <optional>
+#include <string_view>
+
+namespace ImGui {
+
+  namespace ec_detail {
+    /// named value of enum class
+    template <class E>
+    struct enum_entry {
+      E value;
+      const char* name;
+    };
+
+    /// declaration order list of named values (specialized for each enum)
+    template <class E>
+    struct enum_entries;
+
+    /// insertion sort by value (stable, so the first declared alias wins)
+    template <class E, size_t N>
+    constexpr std::array<enum_entry<E>, N>
+      sort_entries_by_value(std::array<enum_entry<E>, N> a) {
+      for (size_t i = 1; i < N; ++i) {
+        for (size_t j = i; j > 0; --j) {
+          if (!(to_underlying_type(a[j].value) <
+                to_underlying_type(a[j - 1].value)))
+            break;
+          auto tmp = a[j];
+          a[j]     = a[j - 1];
+          a[j - 1] = tmp;
+        }
+      }
+      return a;
+    }
+
+    /// insertion sort by name
+    template <class E, size_t N>
+    constexpr std::array<enum_entry<E>, N>
+      sort_entries_by_name(std::array<enum_entry<E>, N> a) {
+      for (size_t i = 1; i < N; ++i) {
+        for (size_t j = i; j > 0; --j) {
+          if (!(std::string_view(a[j].name) < std::string_view(a[j - 1].name)))
+            break;
+          auto tmp = a[j];
+          a[j]     = a[j - 1];
+          a[j - 1] = tmp;
+        }
+      }
+      return a;
+    }
+
+    template <class E, size_t N>
+    constexpr std::array<E, N>
+      entry_values(const std::array<enum_entry<E>, N>& a) {
+      std::array<E, N> ret {};
+      for (size_t i = 0; i < N; ++i)
+        ret[i] = a[i].value;
+      return ret;
+    }
+
+    template <class E, size_t N>
+    constexpr std::array<const char*, N>
+      entry_names(const std::array<enum_entry<E>, N>& a) {
+      std::array<const char*, N> ret {};
+      for (size_t i = 0; i < N; ++i)
+        ret[i] = a[i].name;
+      return ret;
+    }
+
+    /// sorted lookup tables, built at compile time
+    template <class E>
+    struct enum_table {
+      static constexpr auto by_value =
+        sort_entries_by_value(enum_entries<E>::value);
+      static constexpr auto by_name =
+        sort_entries_by_name(enum_entries<E>::value);
+      static constexpr auto values = entry_values(by_value);
+      static constexpr auto names  = entry_names(by_value);
+    };
+  } // namespace ec_detail
+
+  /// number of named values of E
+  template <class E>
+  constexpr size_t EnumCount() {
+    return ec_detail::enum_table<E>::by_value.size();
+  }
+
+  /// named values of E, sorted by value
+  template <class E>
+  constexpr const auto& EnumValues() {
+    return ec_detail::enum_table<E>::values;
+  }
+
+  /// names of EnumValues<E>(), in the same order
+  template <class E>
+  constexpr const auto& EnumNames() {
+    return ec_detail::enum_table<E>::names;
+  }
+
+  /// name of value, or nullptr when value has no name
+  template <class E>
+  constexpr const char* EnumName(E value) {
+    using namespace ec_detail;
+    const auto& table = enum_table<E>::by_value;
+    size_t first = 0, last = table.size();
+    while (first < last) {
+      size_t mid = first + (last - first) / 2;
+      if (to_underlying_type(table[mid].value) < to_underlying_type(value))
+        first = mid + 1;
+      else
+        last = mid;
+    }
+    if (first != table.size() && table[first].value == value)
+      return table[first].name;
+    return nullptr;
+  }
+
+  /// value named name, or nullopt when no value has that name
+  template <class E>
+  constexpr std::optional<E> EnumFromName(std::string_view name) {
+    const auto& table = ec_detail::enum_table<E>::by_name;
+    size_t first = 0, last = table.size();
+    while (first < last) {
+      size_t mid = first + (last - first) / 2;
+      if (std::string_view(table[mid].name) < name)
+        first = mid + 1;
+      else
+        last = mid;
+    }
+    if (first != table.size() && std::string_view(table[first].name) == name)
+      return table[first].value;
+    return std::nullopt;
+  }
+
+  namespace ec_detail {
+
+    // ----------------------------------------
+    // Col
+
+    template <>
+    struct enum_entries<Col> {
+      static constexpr std::array<enum_entry<Col>, 43> value = {{
+        {Col::Text, "Text"},
+        {Col::TextDisabled, "TextDisabled"},
+        {Col::WindowBg, "WindowBg"},
+        {Col::ChildBg, "ChildBg"},
+        {Col::PopupBg, "PopupBg"},
+        {Col::Border, "Border"},
+        {Col::BorderShadow, "BorderShadow"},
+        {Col::FrameBg, "FrameBg"},
+        {Col::FrameBgHovered, "FrameBgHovered"},
+        {Col::FrameBgActive, "FrameBgActive"},
+        {Col::TitleBg, "TitleBg"},
+        {Col::TitleBgActive, "TitleBgActive"},
+        {Col::TitleBgCollapsed, "TitleBgCollapsed"},
+        {Col::MenuBarBg, "MenuBarBg"},
+        {Col::ScrollbarBg, "ScrollbarBg"},
+        {Col::ScrollbarGrab, "ScrollbarGrab"},
+        {Col::ScrollbarGrabHovered, "ScrollbarGrabHovered"},
+        {Col::ScrollbarGrabActive, "ScrollbarGrabActive"},
+        {Col::CheckMark, "CheckMark"},
+        {Col::SliderGrab, "SliderGrab"},
+        {Col::SliderGrabActive, "SliderGrabActive"},
+        {Col::Button, "Button"},
+        {Col::ButtonHovered, "ButtonHovered"},
+        {Col::ButtonActive, "ButtonActive"},
+        {Col::Header, "Header"},
+        {Col::HeaderHovered, "HeaderHovered"},
+        {Col::HeaderActive, "HeaderActive"},
+        {Col::Separator, "Separator"},
+        {Col::SeparatorHovered, "SeparatorHovered"},
+        {Col::SeparatorActive, "SeparatorActive"},
+        {Col::ResizeGrip, "ResizeGrip"},
+        {Col::ResizeGripHovered, "ResizeGripHovered"},
+        {Col::ResizeGripActive, "ResizeGripActive"},
+        {Col::PlotLines, "PlotLines"},
+        {Col::PlotLinesHovered, "PlotLinesHovered"},
+        {Col::PlotHistogram, "PlotHistogram"},
+        {Col::PlotHistogramHovered, "PlotHistogramHovered"},
+        {Col::TextSelectedBg, "TextSelectedBg"},
+        {Col::DragDropTarget, "DragDropTarget"},
+        {Col::NavHighlight, "NavHighlight"},
+        {Col::NavWindowingHighlight, "NavWindowingHighlight"},
+        {Col::NavWindowingDimBg, "NavWindowingDimBg"},
+        {Col::ModalWindowDimBg, "ModalWindowDimBg"},
+      }};
+    };
+
+    // ----------------------------------------
+    // StyleVar
+
+    template <>
+    struct enum_entries<StyleVar> {
+      static constexpr std::array<enum_entry<StyleVar>, 21> value = {{
+        {StyleVar::Alpha, "Alpha"},
+        {StyleVar::WindowPadding, "WindowPadding"},
+        {StyleVar::WindowRounding, "WindowRounding"},
+        {StyleVar::WindowBorderSize, "WindowBorderSize"},
+        {StyleVar::WindowMinSize, "WindowMinSize"},
+        {StyleVar::WindowTitleAlign, "WindowTitleAlign"},
+        {StyleVar::ChildRounding, "ChildRounding"},
+        {StyleVar::ChildBorderSize, "ChildBorderSize"},
+        {StyleVar::PopupRounding, "PopupRounding"},
+        {StyleVar::PopupBorderSize, "PopupBorderSize"},
+        {StyleVar::FramePadding, "FramePadding"},
+        {StyleVar::FrameRounding, "FrameRounding"},
+        {StyleVar::FrameBorderSize, "FrameBorderSize"},
+        {StyleVar::ItemSpacing, "ItemSpacing"},
+        {StyleVar::ItemInnerSpacing, "ItemInnerSpacing"},
+        {StyleVar::IndentSpacing, "IndentSpacing"},
+        {StyleVar::ScrollbarSize, "ScrollbarSize"},
+        {StyleVar::ScrollbarRounding, "ScrollbarRounding"},
+        {StyleVar::GrabMinSize, "GrabMinSize"},
+        {StyleVar::GrabRounding, "GrabRounding"},
+        {StyleVar::ButtonTextAlign, "ButtonTextAlign"},
+      }};
+    };
+
+    // ----------------------------------------
+    // Cond
+
+    template <>
+    struct enum_entries<Cond> {
+      static constexpr std::array<enum_entry<Cond>, 4> value = {{
+        {Cond::Always, "Always"},
+        {Cond::Once, "Once"},
+        {Cond::FirstUseEver, "FirstUseEver"},
+        {Cond::Appearing, "Appearing"},
+      }};
+    };
+
+    // ----------------------------------------
+    // FocusedFlags
+
+    template <>
+    struct enum_entries<FocusedFlags> {
+      static constexpr std::array<enum_entry<FocusedFlags>, 5> value = {{
+        {FocusedFlags::None, "None"},
+        {FocusedFlags::ChildWindows, "ChildWindows"},
+        {FocusedFlags::RootWindow, "RootWindow"},
+        {FocusedFlags::AnyWindow, "AnyWindow"},
+        {FocusedFlags::RootAndChildWindows, "RootAndChildWindows"},
+      }};
+    };
+
+    // ----------------------------------------
+    // HoveredFlags
+
+    template <>
+    struct enum_entries<HoveredFlags> {
+      static constexpr std::array<enum_entry<HoveredFlags>, 10> value = {{
+        {HoveredFlags::None, "None"},
+        {HoveredFlags::ChildWindows, "ChildWindows"},
+        {HoveredFlags::RootWindow, "RootWindow"},
+        {HoveredFlags::AnyWindow, "AnyWindow"},
+        {HoveredFlags::AllowWhenBlockedByPopup, "AllowWhenBlockedByPopup"},
+        {HoveredFlags::AllowWhenBlockedByActiveItem,
+         "AllowWhenBlockedByActiveItem"},
+        {HoveredFlags::AllowWhenOverlapped, "AllowWhenOverlapped"},
+        {HoveredFlags::AllowWhenDisabled, "AllowWhenDisabled"},
+        {HoveredFlags::RectOnly, "RectOnly"},
+        {HoveredFlags::RootAndChildWindows, "RootAndChildWindows"},
+      }};
+    };
+
+    // ----------------------------------------
+    // WindowFlags
+
+    template <>
+    struct enum_entries<WindowFlags> {
+      static constexpr std::array<enum_entry<WindowFlags>, 23> value = {{
+        {WindowFlags::None, "None"},
+        {WindowFlags::NoTitleBar, "NoTitleBar"},
+        {WindowFlags::NoResize, "NoResize"},
+        {WindowFlags::NoMove, "NoMove"},
+        {WindowFlags::NoScrollbar, "NoScrollbar"},
+        {WindowFlags::NoScrollWithMouse, "NoScrollWithMouse"},
+        {WindowFlags::NoCollapse, "NoCollapse"},
+        {WindowFlags::AlwaysAutoReize, "AlwaysAutoReize"},
+        {WindowFlags::NoBackground, "NoBackground"},
+        {WindowFlags::NoSavedSettings, "NoSavedSettings"},
+        {WindowFlags::NoMouseInputs, "NoMouseInputs"},
+        {WindowFlags::MenuBar, "MenuBar"},
+        {WindowFlags::HorizontalScrollbar, "HorizontalScrollbar"},
+        {WindowFlags::NoFocusOnAppearing, "NoFocusOnAppearing"},
+        {WindowFlags::NoBringToFrontOnFocus, "NoBringToFrontOnFocus"},
+        {WindowFlags::AlwaysVerticalScrollbar, "AlwaysVerticalScrollbar"},
+        {WindowFlags::AlwaysHorizontalScrollbar, "AlwaysHorizontalScrollbar"},
+        {WindowFlags::AlwaysUseWindowPadding, "AlwaysUseWindowPadding"},
+        {WindowFlags::NoNavInputs, "NoNavInputs"},
+        {WindowFlags::NoNavFocus, "NoNavFocus"},
+        {WindowFlags::NoNav, "NoNav"},
+        {WindowFlags::NoDecoration, "NoDecoration"},
+        {WindowFlags::NoInputs, "NoInputs"},
+      }};
+    };
+
+    // ----------------------------------------
+    // Key
+
+    template <>
+    struct enum_entries<Key> {
+      static constexpr std::array<enum_entry<Key>, 21> value = {{
+        {Key::Tab, "Tab"},
+        {Key::LeftArrow, "LeftArrow"},
+        {Key::RightArrow, "RightArrow"},
+        {Key::UpArrow, "UpArrow"},
+        {Key::DownArrow, "DownArrow"},
+        {Key::PageUp, "PageUp"},
+        {Key::PageDown, "PageDown"},
+        {Key::Home, "Home"},
+        {Key::End, "End"},
+        {Key::Insert, "Insert"},
+        {Key::Delete, "Delete"},
+        {Key::Backspace, "Backspace"},
+        {Key::Space, "Space"},
+        {Key::Enter, "Enter"},
+        {Key::Escape, "Escape"},
+        {Key::A, "A"},
+        {Key::C, "C"},
+        {Key::V, "V"},
+        {Key::X, "X"},
+        {Key::Y, "Y"},
+        {Key::Z, "Z"},
+      }};
+    };
+
+    // ----------------------------------------
+    // NavInput
+
+    template <>
+    struct enum_entries<NavInput> {
+      static constexpr std::array<enum_entry<NavInput>, 16> value = {{
+        {NavInput::Activate, "Activate"},
+        {NavInput::Cancel, "Cancel"},
+        {NavInput::Input, "Input"},
+        {NavInput::Menu, "Menu"},
+        {NavInput::DpadLeft, "DpadLeft"},
+        {NavInput::DpadRight, "DpadRight"},
+        {NavInput::DpadUp, "DpadUp"},
+        {NavInput::DpadDown, "DpadDown"},
+        {NavInput::LStickLeft, "LStickLeft"},
+        {NavInput::LStickRight, "LStickRight"},
+        {NavInput::LStickUp, "LStickUp"},
+        {NavInput::LStickDown, "LStickDown"},
+        {NavInput::FocusPrev, "FocusPrev"},
+        {NavInput::FocusNext, "FocusNext"},
+        {NavInput::TweakSlow, "TweakSlow"},
+        {NavInput::TweakFast, "TweakFast"},
+      }};
+    };
+
+    // ----------------------------------------
+    // MouseCursor
+
+    template <>
+    struct enum_entries<MouseCursor> {
+      static constexpr std::array<enum_entry<MouseCursor>, 9> value = {{
+        {MouseCursor::None, "None"},
+        {MouseCursor::Arrow, "Arrow"},
+        {MouseCursor::TextInput, "TextInput"},
+        {MouseCursor::ResizeAll, "ResizeAll"},
+        {MouseCursor::ResizeNS, "ResizeNS"},
+        {MouseCursor::ResizeEW, "ResizeEW"},
+        {MouseCursor::ResizeNESW, "ResizeNESW"},
+        {MouseCursor::ResizeNWSE, "ResizeNWSE"},
+        {MouseCursor::Hand, "Hand"},
+      }};
+    };
+
+    // ----------------------------------------
+    // ConfigFlags
+
+    template <>
+    struct enum_entries<ConfigFlags> {
+      static constexpr std::array<enum_entry<ConfigFlags>, 8> value = {{
+        {ConfigFlags::NavEnableKeyboard, "NavEnableKeyboard"},
+        {ConfigFlags::NavEnableGamepad, "NavEnableGamepad"},
+        {ConfigFlags::NavEnableSetMousePos, "NavEnableSetMousePos"},
+        {ConfigFlags::NavNoCaptureKeyboard, "NavNoCaptureKeyboard"},
+        {ConfigFlags::NoMouse, "NoMouse"},
+        {ConfigFlags::NoMouseCursorChange, "NoMouseCursorChange"},
+        {ConfigFlags::IsSRGB, "IsSRGB"},
+        {ConfigFlags::IsTouchScreen, "IsTouchScreen"},
+      }};
+    };
+
+    // ----------------------------------------
+    // BackendFlags
+
+    template <>
+    struct enum_entries<BackendFlags> {
+      static constexpr std::array<enum_entry<BackendFlags>, 3> value = {{
+        {BackendFlags::HasGamepad, "HasGamepad"},
+        {BackendFlags::HasMouseCursors, "HasMouseCursors"},
+        {BackendFlags::HasSetMousePos, "HasSetMousePos"},
+      }};
+    };
+
+    // ----------------------------------------
+    // DataType
+
+    template <>
+    struct enum_entries<DataType> {
+      static constexpr std::array<enum_entry<DataType>, 6> value = {{
+        {DataType::S32, "S32"},
+        {DataType::U32, "U32"},
+        {DataType::S64, "S64"},
+        {DataType::U64, "U64"},
+        {DataType::Float, "Float"},
+        {DataType::Double, "Double"},
+      }};
+    };
+
+    // ----------------------------------------
+    // InputTextFlags
+
+    template <>
+    struct enum_entries<InputTextFlags> {
+      static constexpr std::array<enum_entry<InputTextFlags>, 20> value = {{
+        {InputTextFlags::None, "None"},
+        {InputTextFlags::CharsDecimal, "CharsDecimal"},
+        {InputTextFlags::CharsHexadecimal, "CharsHexadecimal"},
+        {InputTextFlags::CharsUppercase, "CharsUppercase"},
+        {InputTextFlags::CharsNoBlank, "CharsNoBlank"},
+        {InputTextFlags::AutoSelectAll, "AutoSelectAll"},
+        {InputTextFlags::EnterReturnsTure, "EnterReturnsTure"},
+        {InputTextFlags::CallbackCompletion, "CallbackCompletion"},
+        {InputTextFlags::CallbackHistory, "CallbackHistory"},
+        {InputTextFlags::CallbackAlways, "CallbackAlways"},
+        {InputTextFlags::CallbackCharFilter, "CallbackCharFilter"},
+        {InputTextFlags::AllowTabInput, "AllowTabInput"},
+        {InputTextFlags::CtrlEnterForNewLine, "CtrlEnterForNewLine"},
+        {InputTextFlags::NoHorizontalScroll, "NoHorizontalScroll"},
+        {InputTextFlags::AlwaysInsertMode, "AlwaysInsertMode"},
+        {InputTextFlags::ReadOnly, "ReadOnly"},
+        {InputTextFlags::Password, "Password"},
+        {InputTextFlags::NoUndoRedo, "NoUndoRedo"},
+        {InputTextFlags::CharsScientific, "CharsScientific"},
+        {InputTextFlags::CallbackResize, "CallbackResize"},
+      }};
+    };
+
+    // ----------------------------------------
+    // DrawCornerFlags
+
+    template <>
+    struct enum_entries<DrawCornerFlags> {
+      static constexpr std::array<enum_entry<DrawCornerFlags>, 9> value = {{
+        {DrawCornerFlags::TopLeft, "TopLeft"},
+        {DrawCornerFlags::TopRight, "TopRight"},
+        {DrawCornerFlags::BotLeft, "BotLeft"},
+        {DrawCornerFlags::BotRight, "BotRight"},
+        {DrawCornerFlags::Top, "Top"},
+        {DrawCornerFlags::Bot, "Bot"},
+        {DrawCornerFlags::Left, "Left"},
+        {DrawCornerFlags::Right, "Right"},
+        {DrawCornerFlags::All, "All"},
+      }};
+    };
+
+    // ----------------------------------------
+    // DrawListFlags
+
+    template <>
+    struct enum_entries<DrawListFlags> {
+      static constexpr std::array<enum_entry<DrawListFlags>, 2> value = {{
+        {DrawListFlags::AntiAliasedLines, "AntiAliasedLines"},
+        {DrawListFlags::AntiAliasedFill, "AntiAliasedFill"},
+      }};
+    };
+
+    // ----------------------------------------
+    // FontAtlasFlags
+
+    template <>
+    struct enum_entries<FontAtlasFlags> {
+      static constexpr std::array<enum_entry<FontAtlasFlags>, 3> value = {{
+        {FontAtlasFlags::None, "None"},
+        {FontAtlasFlags::NoPowerOfTwoHeight, "NoPowerOfTwoHeight"},
+        {FontAtlasFlags::NoMouseCursors, "NoMouseCursors"},
+      }};
+    };
+
+    // ----------------------------------------
+    // Dir
+
+    template <>
+    struct enum_entries<Dir> {
+      static constexpr std::array<enum_entry<Dir>, 5> value = {{
+        {Dir::None, "None"},
+        {Dir::Left, "Left"},
+        {Dir::Right, "Right"},
+        {Dir::Up, "Up"},
+        {Dir::Down, "Down"},
+      }};
+    };
+
+    // ----------------------------------------
+    // ColorEditFlags
+
+    template <>
+    struct enum_entries<ColorEditFlags> {
+      static constexpr std::array<enum_entry<ColorEditFlags>, 21> value = {{
+        {ColorEditFlags::None, "None"},
+        {ColorEditFlags::NoAlpha, "NoAlpha"},
+        {ColorEditFlags::NoPicker, "NoPicker"},
+        {ColorEditFlags::NoOptions, "NoOptions"},
+        {ColorEditFlags::NoSmallPreview, "NoSmallPreview"},
+        {ColorEditFlags::NoInputs, "NoInputs"},
+        {ColorEditFlags::NoTooltip, "NoTooltip"},
+        {ColorEditFlags::NoLabel, "NoLabel"},
+        {ColorEditFlags::NoSidePreview, "NoSidePreview"},
+        {ColorEditFlags::NoDragDrop, "NoDragDrop"},
+        {ColorEditFlags::AlphaBar, "AlphaBar"},
+        {ColorEditFlags::AlphaPreview, "AlphaPreview"},
+        {ColorEditFlags::AlphaPreviewHalf, "AlphaPreviewHalf"},
+        {ColorEditFlags::HDR, "HDR"},
+        {ColorEditFlags::RGB, "RGB"},
+        {ColorEditFlags::HSV, "HSV"},
+        {ColorEditFlags::HEX, "HEX"},
+        {ColorEditFlags::Uint8, "Uint8"},
+        {ColorEditFlags::Float, "Float"},
+        {ColorEditFlags::PickerHueBar, "PickerHueBar"},
+        {ColorEditFlags::PickerHueWheel, "PickerHueWheel"},
+      }};
+    };
+
+    // ----------------------------------------
+    // ColumnsFlags
+
+    template <>
+    struct enum_entries<ColumnsFlags> {
+      static constexpr std::array<enum_entry<ColumnsFlags>, 0> value = {};
+    };
+
+    // ----------------------------------------
+    // ComboFlags
+
+    template <>
+    struct enum_entries<ComboFlags> {
+      static constexpr std::array<enum_entry<ComboFlags>, 9> value = {{
+        {ComboFlags::None, "None"},
+        {ComboFlags::PopupAlignLeft, "PopupAlignLeft"},
+        {ComboFlags::HeightSmall, "HeightSmall"},
+        {ComboFlags::HeightRegular, "HeightRegular"},
+        {ComboFlags::HeightLarge, "HeightLarge"},
+        {ComboFlags::HeightLargest, "HeightLargest"},
+        {ComboFlags::NoArrowButton, "NoArrowButton"},
+        {ComboFlags::NoPreview, "NoPreview"},
+        {ComboFlags::HeightMask_, "HeightMask_"},
+      }};
+    };
+
+    // ----------------------------------------
+    // DragDropFlags
+
+    template <>
+    struct enum_entries<DragDropFlags> {
+      static constexpr std::array<enum_entry<DragDropFlags>, 11> value = {{
+        {DragDropFlags::None, "None"},
+        {DragDropFlags::SourceNoPreviewTooltip, "SourceNoPreviewTooltip"},
+        {DragDropFlags::SourceNoDisableHover, "SourceNoDisableHover"},
+        {DragDropFlags::SourceNoHoldToOpenOthers, "SourceNoHoldToOpenOthers"},
+        {DragDropFlags::SourceAllowNullID, "SourceAllowNullID"},
+        {DragDropFlags::SourceExtern, "SourceExtern"},
+        {DragDropFlags::SourceAutoExpirePayload, "SourceAutoExpirePayload"},
+        {DragDropFlags::AcceptBeforeDelivery, "AcceptBeforeDelivery"},
+        {DragDropFlags::AcceptNoDrawDefaultRect, "AcceptNoDrawDefaultRect"},
+        {DragDropFlags::AcceptNoPreviewTooltip, "AcceptNoPreviewTooltip"},
+        {DragDropFlags::AcceptPeekOnly, "AcceptPeekOnly"},
+      }};
+    };
+
+    // ----------------------------------------
+    // SelectableFlags
+
+    template <>
+    struct enum_entries<SelectableFlags> {
+      static constexpr std::array<enum_entry<SelectableFlags>, 5> value = {{
+        {SelectableFlags::None, "None"},
+        {SelectableFlags::DontClosePopups, "DontClosePopups"},
+        {SelectableFlags::SpanAllColumns, "SpanAllColumns"},
+        {SelectableFlags::AllowDoubleClick, "AllowDoubleClick"},
+        {SelectableFlags::Disabled, "Disabled"},
+      }};
+    };
+
+    // ----------------------------------------
+    // TreeNodeFlags
+
+    template <>
+    struct enum_entries<TreeNodeFlags> {
+      static constexpr std::array<enum_entry<TreeNodeFlags>, 14> value = {{
+        {TreeNodeFlags::None, "None"},
+        {TreeNodeFlags::Selected, "Selected"},
+        {TreeNodeFlags::Framed, "Framed"},
+        {TreeNodeFlags::AllowItemOverlap, "AllowItemOverlap"},
+        {TreeNodeFlags::NoTreePushOnOpen, "NoTreePushOnOpen"},
+        {TreeNodeFlags::NoAutoOpenOnLog, "NoAutoOpenOnLog"},
+        {TreeNodeFlags::DefaultOpen, "DefaultOpen"},
+        {TreeNodeFlags::OpenOnDoubleClick, "OpenOnDoubleClick"},
+        {TreeNodeFlags::OpenOnArrow, "OpenOnArrow"},
+        {TreeNodeFlags::Leaf, "Leaf"},
+        {TreeNodeFlags::Bullet, "Bullet"},
+        {TreeNodeFlags::FramePadding, "FramePadding"},
+        {TreeNodeFlags::NavLeftJumpsBackHere, "NavLeftJumpsBackHere"},
+        {TreeNodeFlags::CollapsingHeader, "CollapsingHeader"},
+      }};
+    };
+
+  } // namespace ec_detail
+
+  // the tables of the sequential enums list every value of this ImGui
+  static_assert(EnumCount<Col>() == ImGuiCol_COUNT, "Col table is stale");
+  static_assert(
+    EnumCount<StyleVar>() == ImGuiStyleVar_COUNT, "StyleVar table is stale");
+  static_assert(EnumCount<Key>() == ImGuiKey_COUNT, "Key table is stale");
+  static_assert(
+    EnumCount<NavInput>() == ImGuiNavInput_InternalStart_,
+    "NavInput table is stale");
+  static_assert(
+    EnumCount<MouseCursor>() == ImGuiMouseCursor_COUNT + 1, // and None
+    "MouseCursor table is stale");
+  static_assert(
+    EnumCount<DataType>() == ImGuiDataType_COUNT, "DataType table is stale");
+  static_assert(
+    EnumCount<Dir>() == ImGuiDir_COUNT + 1, // and None
+    "Dir table is stale");
+
+} // namespace ImGui
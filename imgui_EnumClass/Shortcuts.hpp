@@ -0,0 +1,279 @@
+#pragma once
+
+#include "Input.hpp"
+#include "Window.hpp"
+
+namespace ImGui {
+
+  // ----------------------------------------
+  // KeyMod
+
+  /// modifier keys of a KeyStroke
+  enum class KeyMod : int {
+    None  = 0,
+    Ctrl  = 1 << 0,
+    Shift = 1 << 1,
+    Alt   = 1 << 2,
+    Super = 1 << 3,
+  };
+
+  template <>
+  struct ec_detail::is_enum_flag<KeyMod> : std::true_type {};
+
+  /// modifiers currently held
+  inline KeyMod GetKeyMods() {
+    const ImGuiIO& io = ImGui::GetIO();
+    return static_cast<KeyMod>(
+      (io.KeyCtrl ? 1 : 0) | (io.KeyShift ? 2 : 0) | (io.KeyAlt ? 4 : 0) |
+      (io.KeySuper ? 8 : 0));
+  }
+
+  /// a Key (or a KeysDown index for keys without a Key) with modifiers
+  struct KeyStroke {
+    int key;
+    bool raw;
+    KeyMod mods;
+
+    KeyStroke(Key k, KeyMod m = KeyMod::None)
+      : key(static_cast<int>(k))
+      , raw(false)
+      , mods(m) {}
+
+    /// stroke of a backend key index, e.g. a function key
+    static KeyStroke Raw(int user_key_index, KeyMod m = KeyMod::None) {
+      KeyStroke s(Key::Tab, m);
+      s.key = user_key_index;
+      s.raw = true;
+      return s;
+    }
+  };
+
+  /// Registry of keyboard shortcuts dispatched from one table.
+  /// Bindings are chained per key, and Dispatch() only tests the keys which
+  /// have bindings, so a frame costs the same for any number of shortcuts.
+  /// A scoped binding fires only when its scope was marked focused this
+  /// frame with Scope(), and wins over global bindings of the same stroke.
+  /// ```
+  /// enum { Undo, Help, SelectAll, Quit, kEditor = 1 };
+  /// static ImGui::Shortcuts shortcuts;
+  /// shortcuts.Add(Undo, {ImGui::Key::Z, ImGui::KeyMod::Ctrl}, 0, true);
+  /// shortcuts.Add(Help, ImGui::KeyStroke::Raw(GLFW_KEY_F1));
+  /// shortcuts.Add(SelectAll, {ImGui::Key::A, ImGui::KeyMod::Ctrl}, kEditor);
+  /// shortcuts.Add(
+  ///   Quit, {ImGui::Key::X, ImGui::KeyMod::Ctrl},
+  ///   {ImGui::Key::C, ImGui::KeyMod::Ctrl}); // Ctrl+X Ctrl+C
+  ///
+  /// // every frame
+  /// ImGui::Begin("Editor");
+  /// shortcuts.Scope(kEditor);
+  /// ImGui::End();
+  /// shortcuts.Dispatch();
+  /// if (shortcuts.IsTriggered(Undo)) ...
+  /// ```
+  class Shortcuts {
+  public:
+    Shortcuts()
+      : m_dirty(true)
+      , m_pending(false)
+      , m_pending_key(-1)
+      , m_pending_mods(KeyMod::None) {}
+
+    /// Binds action to stroke. scope 0 is active everywhere. repeat also
+    /// fires on key repeat.
+    void Add(
+      int action, KeyStroke stroke, ImGuiID scope = 0, bool repeat = false) {
+      const Binding b = {
+        action, scope, stroke, stroke, false, repeat, -1, -1, -1, -1};
+      m_bindings.push_back(b);
+      m_dirty = true;
+    }
+
+    /// Binds action to the chord first, second.
+    void Add(int action, KeyStroke first, KeyStroke second, ImGuiID scope = 0) {
+      const Binding b = {
+        action, scope, second, first, true, false, -1, -1, -1, -1};
+      m_bindings.push_back(b);
+      m_dirty = true;
+    }
+
+    void Clear() {
+      m_bindings.resize(0);
+      m_pending = false;
+      m_dirty   = true;
+    }
+
+    /// Marks scope active for this frame when the current window is focused
+    /// according to flags. Call it between Begin() and End().
+    bool Scope(
+      ImGuiID scope, FocusedFlags flags = FocusedFlags::RootAndChildWindows) {
+      if (!IsWindowFocused(flags))
+        return false;
+      m_scopes.push_back(scope);
+      return true;
+    }
+
+    /// Turns the key presses of this frame into triggered actions. Call it
+    /// once per frame after the windows calling Scope(). Strokes without
+    /// Ctrl, Alt or Super are ignored while a text input is active.
+    int Dispatch() {
+      if (m_dirty)
+        Build();
+      m_triggered.resize(0);
+
+      const ImGuiIO& io = ImGui::GetIO();
+      const KeyMod mods = GetKeyMods();
+      const bool typing =
+        io.WantTextInput &&
+        !ec_detail::has_any(mods, KeyMod::Ctrl | KeyMod::Alt | KeyMod::Super);
+      for (int key : m_keys) {
+        if (typing || !ImGui::IsKeyPressed(key, true))
+          continue;
+        OnStroke(key, mods, io.KeysDownDuration[key] > 0.0f);
+      }
+      m_scopes.resize(0);
+      return m_triggered.Size;
+    }
+
+    /// actions triggered by the last Dispatch()
+    const ImVector<int>& GetTriggered() const {
+      return m_triggered;
+    }
+    bool IsTriggered(int action) const {
+      for (int a : m_triggered)
+        if (a == action)
+          return true;
+      return false;
+    }
+
+    /// the first stroke of a chord was pressed
+    bool IsChordPending() const {
+      return m_pending;
+    }
+    void CancelChord() {
+      m_pending = false;
+    }
+
+  private:
+    static constexpr int kKeyCount = sizeof(ImGuiIO::KeysDown) / sizeof(bool);
+
+    struct Binding {
+      int action;
+      ImGuiID scope;
+      KeyStroke stroke;
+      KeyStroke prefix;
+      bool has_prefix;
+      bool repeat;
+      // set by Build()
+      int key;         // KeysDown index of stroke
+      int prefix_key;  // KeysDown index of prefix
+      int next;        // next binding of key
+      int prefix_next; // next chord of prefix_key
+    };
+
+    /// KeysDown index of s, or -1 when it is not mapped
+    static int Resolve(const KeyStroke& s) {
+      const int index =
+        s.raw ? s.key
+              : (s.key < ImGuiKey_COUNT ? ImGui::GetIO().KeyMap[s.key] : -1);
+      return index >= 0 && index < kKeyCount ? index : -1;
+    }
+
+    void Build() {
+      m_heads.resize(kKeyCount);
+      m_prefix_heads.resize(kKeyCount);
+      for (int i = 0; i < kKeyCount; ++i)
+        m_heads[i] = m_prefix_heads[i] = -1;
+      m_keys.resize(0);
+
+      // reversed, so chains keep the order of Add()
+      for (int i = m_bindings.Size - 1; i >= 0; --i) {
+        Binding& b = m_bindings[i];
+        b.key        = Resolve(b.stroke);
+        b.prefix_key = b.has_prefix ? Resolve(b.prefix) : -1;
+        b.next = b.prefix_next = -1;
+        if (b.key < 0 || (b.has_prefix && b.prefix_key < 0))
+          continue;
+        b.next         = m_heads[b.key];
+        m_heads[b.key] = i;
+        if (b.has_prefix) {
+          b.prefix_next                = m_prefix_heads[b.prefix_key];
+          m_prefix_heads[b.prefix_key] = i;
+        }
+      }
+      for (int i = 0; i < kKeyCount; ++i)
+        if (m_heads[i] >= 0 || m_prefix_heads[i] >= 0)
+          m_keys.push_back(i);
+      m_dirty = false;
+    }
+
+    /// 0 when scope is not active, higher for later Scope() calls
+    int ScopeRank(ImGuiID scope) const {
+      if (scope == 0)
+        return 1;
+      for (int i = m_scopes.Size - 1; i >= 0; --i)
+        if (m_scopes[i] == scope)
+          return i + 2;
+      return 0;
+    }
+
+    /// best active binding of key+mods (after the pending prefix if chord)
+    int Find(int key, KeyMod mods, bool chord, bool repeated) const {
+      int best = -1, best_rank = 0;
+      for (int i = m_heads[key]; i >= 0; i = m_bindings[i].next) {
+        const Binding& b = m_bindings[i];
+        if (
+          b.stroke.mods != mods || b.has_prefix != chord ||
+          (repeated && !b.repeat) ||
+          (chord &&
+           (b.prefix_key != m_pending_key || b.prefix.mods != m_pending_mods)))
+          continue;
+        const int rank = ScopeRank(b.scope);
+        if (rank > best_rank) {
+          best      = i;
+          best_rank = rank;
+        }
+      }
+      return best;
+    }
+
+    bool IsPrefix(int key, KeyMod mods) const {
+      for (int i = m_prefix_heads[key]; i >= 0; i = m_bindings[i].prefix_next) {
+        const Binding& b = m_bindings[i];
+        if (b.prefix.mods == mods && ScopeRank(b.scope) != 0)
+          return true;
+      }
+      return false;
+    }
+
+    void OnStroke(int key, KeyMod mods, bool repeated) {
+      if (m_pending && !repeated) {
+        const int b = Find(key, mods, true, false);
+        m_pending   = false;
+        if (b >= 0) {
+          m_triggered.push_back(m_bindings[b].action);
+          return;
+        }
+      }
+      const int b = Find(key, mods, false, repeated);
+      if (b >= 0) {
+        m_triggered.push_back(m_bindings[b].action);
+      } else if (!repeated && IsPrefix(key, mods)) {
+        m_pending      = true;
+        m_pending_key  = key;
+        m_pending_mods = mods;
+      }
+    }
+
+    ImVector<Binding> m_bindings;
+    ImVector<int> m_heads;        // first binding of each KeysDown index
+    ImVector<int> m_prefix_heads; // first chord starting with each index
+    ImVector<int> m_keys;         // indices with bindings or chords
+    ImVector<ImGuiID> m_scopes;   // focused this frame
+    ImVector<int> m_triggered;
+    bool m_dirty;
+    bool m_pending; // waiting for the second stroke of a chord
+    int m_pending_key;
+    KeyMod m_pending_mods;
+  };
+
+} // namespace ImGui
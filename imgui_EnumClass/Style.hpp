@@ -0,0 +1,123 @@
+#pragma once
+
+#include "Flags.hpp"
+
+namespace ImGui {
+
+  // ----------------------------------------
+  // Col
+
+  /// ImGuiCol
+  enum class Col : int {
+    Text                  = ImGuiCol_Text,
+    TextDisabled          = ImGuiCol_TextDisabled,
+    WindowBg              = ImGuiCol_WindowBg,
+    ChildBg               = ImGuiCol_ChildBg,
+    PopupBg               = ImGuiCol_PopupBg,
+    Border                = ImGuiCol_Border,
+    BorderShadow          = ImGuiCol_BorderShadow,
+    FrameBg               = ImGuiCol_FrameBg,
+    FrameBgHovered        = ImGuiCol_FrameBgHovered,
+    FrameBgActive         = ImGuiCol_FrameBgActive,
+    TitleBg               = ImGuiCol_TitleBg,
+    TitleBgActive         = ImGuiCol_TitleBgActive,
+    TitleBgCollapsed      = ImGuiCol_TitleBgCollapsed,
+    MenuBarBg             = ImGuiCol_MenuBarBg,
+    ScrollbarBg           = ImGuiCol_ScrollbarBg,
+    ScrollbarGrab         = ImGuiCol_ScrollbarGrab,
+    ScrollbarGrabHovered  = ImGuiCol_ScrollbarGrabHovered,
+    ScrollbarGrabActive   = ImGuiCol_ScrollbarGrabActive,
+    CheckMark             = ImGuiCol_CheckMark,
+    SliderGrab            = ImGuiCol_SliderGrab,
+    SliderGrabActive      = ImGuiCol_SliderGrabActive,
+    Button                = ImGuiCol_Button,
+    ButtonHovered         = ImGuiCol_ButtonHovered,
+    ButtonActive          = ImGuiCol_ButtonActive,
+    Header                = ImGuiCol_Header,
+    HeaderHovered         = ImGuiCol_HeaderHovered,
+    HeaderActive          = ImGuiCol_HeaderActive,
+    Separator             = ImGuiCol_Separator,
+    SeparatorHovered      = ImGuiCol_SeparatorHovered,
+    SeparatorActive       = ImGuiCol_SeparatorActive,
+    ResizeGrip            = ImGuiCol_ResizeGrip,
+    ResizeGripHovered     = ImGuiCol_ResizeGripHovered,
+    ResizeGripActive      = ImGuiCol_ResizeGripActive,
+    PlotLines             = ImGuiCol_PlotLines,
+    PlotLinesHovered      = ImGuiCol_PlotLinesHovered,
+    PlotHistogram         = ImGuiCol_PlotHistogram,
+    PlotHistogramHovered  = ImGuiCol_PlotHistogramHovered,
+    TextSelectedBg        = ImGuiCol_TextSelectedBg,
+    DragDropTarget        = ImGuiCol_DragDropTarget,
+    NavHighlight          = ImGuiCol_NavHighlight,
+    NavWindowingHighlight = ImGuiCol_NavWindowingHighlight,
+    NavWindowingDimBg     = ImGuiCol_NavWindowingDimBg,
+    ModalWindowDimBg      = ImGuiCol_ModalWindowDimBg,
+  };
+
+  inline void PushStyleColor(Col idx, ImU32 col) {
+    IMGUI_EC_HOOK("PushStyleColor");
+    return PushStyleColor(static_cast<ImGuiCol>(idx), col);
+  }
+  inline void PushStyleColor(Col idx, const ImVec4& col) {
+    IMGUI_EC_HOOK("PushStyleColor");
+    return PushStyleColor(static_cast<ImGuiCol>(idx), col);
+  }
+  inline const ImVec4& GetStyleColorVec4(Col idx) {
+    return GetStyleColorVec4(static_cast<ImGuiCol>(idx));
+  }
+  inline ImU32 GetColorU32(Col idx, float alpha_mul = 1.0f) {
+    IMGUI_EC_HOOK("GetColorU32");
+    return GetColorU32(static_cast<ImGuiCol>(idx), alpha_mul);
+  }
+
+  namespace ec_detail {
+    /// bumped by TouchStyle(), 0 is never used
+    inline ImU32 style_generation = 1;
+  } // namespace ec_detail
+
+  /// Tells the caches of ColorCache.hpp that style colors changed without
+  /// a change of stack depth they can see. Palette and PaletteScope call
+  /// it; call it after writing ImGuiStyle directly.
+  inline void TouchStyle() {
+    if (++ec_detail::style_generation == 0)
+      ec_detail::style_generation = 1;
+  }
+
+  // ----------------------------------------
+  // StyleVar
+
+  /// ImGuiStyleVar
+  enum class StyleVar : int {
+    Alpha             = ImGuiStyleVar_Alpha,
+    WindowPadding     = ImGuiStyleVar_WindowPadding,
+    WindowRounding    = ImGuiStyleVar_WindowRounding,
+    WindowBorderSize  = ImGuiStyleVar_WindowBorderSize,
+    WindowMinSize     = ImGuiStyleVar_WindowMinSize,
+    WindowTitleAlign  = ImGuiStyleVar_WindowTitleAlign,
+    ChildRounding     = ImGuiStyleVar_ChildRounding,
+    ChildBorderSize   = ImGuiStyleVar_ChildBorderSize,
+    PopupRounding     = ImGuiStyleVar_PopupRounding,
+    PopupBorderSize   = ImGuiStyleVar_PopupBorderSize,
+    FramePadding      = ImGuiStyleVar_FramePadding,
+    FrameRounding     = ImGuiStyleVar_FrameRounding,
+    FrameBorderSize   = ImGuiStyleVar_FrameBorderSize,
+    ItemSpacing       = ImGuiStyleVar_ItemSpacing,
+    ItemInnerSpacing  = ImGuiStyleVar_ItemInnerSpacing,
+    IndentSpacing     = ImGuiStyleVar_IndentSpacing,
+    ScrollbarSize     = ImGuiStyleVar_ScrollbarSize,
+    ScrollbarRounding = ImGuiStyleVar_ScrollbarRounding,
+    GrabMinSize       = ImGuiStyleVar_GrabMinSize,
+    GrabRounding      = ImGuiStyleVar_GrabRounding,
+    ButtonTextAlign   = ImGuiStyleVar_ButtonTextAlign,
+  };
+
+  inline void PushStyleVar(StyleVar idx, float val) {
+    IMGUI_EC_HOOK("PushStyleVar");
+    return ImGui::PushStyleVar(static_cast<ImGuiStyleVar>(idx), val);
+  }
+  inline void PushStyleVar(StyleVar idx, const ImVec2& val) {
+    IMGUI_EC_HOOK("PushStyleVar");
+    return ImGui::PushStyleVar(static_cast<ImGuiStyleVar>(idx), val);
+  }
+
+} // namespace ImGui
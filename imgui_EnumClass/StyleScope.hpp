@@ -0,0 +1,145 @@
+#pragma once
+
+#include "Style.hpp"
+
+#include <imgui_internal.h> // GImGui
+
+namespace ImGui {
+
+  namespace ec_detail {
+    /// value type of StyleVar (float or ImVec2)
+    template <StyleVar Idx>
+    struct style_var_value {
+      using type = float;
+    };
+
+    template <>
+    struct style_var_value<StyleVar::WindowPadding> {
+      using type = ImVec2;
+    };
+    template <>
+    struct style_var_value<StyleVar::WindowMinSize> {
+      using type = ImVec2;
+    };
+    template <>
+    struct style_var_value<StyleVar::WindowTitleAlign> {
+      using type = ImVec2;
+    };
+    template <>
+    struct style_var_value<StyleVar::FramePadding> {
+      using type = ImVec2;
+    };
+    template <>
+    struct style_var_value<StyleVar::ItemSpacing> {
+      using type = ImVec2;
+    };
+    template <>
+    struct style_var_value<StyleVar::ItemInnerSpacing> {
+      using type = ImVec2;
+    };
+    template <>
+    struct style_var_value<StyleVar::ButtonTextAlign> {
+      using type = ImVec2;
+    };
+
+    /// alias
+    template <StyleVar Idx>
+    using style_var_value_t = typename style_var_value<Idx>::type;
+  } // namespace ec_detail
+
+  /// {StyleVar, value} pair for StyleScope
+  template <StyleVar Idx>
+  struct StyleVarEntry {
+    using value_type = ec_detail::style_var_value_t<Idx>;
+
+    template <class T>
+    StyleVarEntry(const T& v)
+      : value(v) {
+      static_assert(
+        std::is_same_v<T, ImVec2> == std::is_same_v<value_type, ImVec2>,
+        "StyleVar arity mismatch (float vs ImVec2)");
+    }
+
+    value_type value;
+  };
+
+  /// {Col, color} pair for StyleScope
+  template <Col Idx>
+  struct StyleColorEntry {
+    StyleColorEntry(const ImVec4& col)
+      : value(col) {}
+    StyleColorEntry(ImU32 col)
+      : value(ImGui::ColorConvertU32ToFloat4(col)) {}
+
+    ImVec4 value;
+  };
+
+  namespace ec_detail {
+    template <class T>
+    struct is_style_var_entry : std::false_type {};
+    template <StyleVar Idx>
+    struct is_style_var_entry<StyleVarEntry<Idx>> : std::true_type {};
+
+    template <class T>
+    struct is_style_color_entry : std::false_type {};
+    template <Col Idx>
+    struct is_style_color_entry<StyleColorEntry<Idx>> : std::true_type {};
+
+    template <StyleVar Idx>
+    void push_style_entry(const StyleVarEntry<Idx>& e) {
+      ImGui::PushStyleVar(static_cast<ImGuiStyleVar>(Idx), e.value);
+    }
+    template <Col Idx>
+    void push_style_entry(const StyleColorEntry<Idx>& e) {
+      ImGui::PushStyleColor(static_cast<ImGuiCol>(Idx), e.value);
+    }
+  } // namespace ec_detail
+
+  /// Pushes a fixed list of StyleVar/Col entries and pops all of them on
+  /// destruction.
+  /// ```
+  /// ImGui::StyleScope style(
+  ///   ImGui::StyleVarEntry<ImGui::StyleVar::Alpha>(0.5f),
+  ///   ImGui::StyleVarEntry<ImGui::StyleVar::FramePadding>(ImVec2(4, 2)),
+  ///   ImGui::StyleColorEntry<ImGui::Col::Text>(IM_COL32(255, 0, 0, 255)));
+  /// ```
+  template <class... Entries>
+  class StyleScope {
+    static_assert(
+      ((ec_detail::is_style_var_entry<Entries>::value ||
+        ec_detail::is_style_color_entry<Entries>::value) &&
+       ...),
+      "StyleScope takes StyleVarEntry or StyleColorEntry");
+
+  public:
+    /// number of pushed StyleVar entries
+    static constexpr int var_count =
+      (0 + ... + ec_detail::is_style_var_entry<Entries>::value);
+    /// number of pushed Col entries
+    static constexpr int color_count =
+      (0 + ... + ec_detail::is_style_color_entry<Entries>::value);
+
+    StyleScope(const Entries&... entries) {
+      ImGuiContext& g = *GImGui;
+      // grow each modifier stack once for the whole batch
+      if constexpr (var_count != 0)
+        g.StyleModifiers.reserve(g.StyleModifiers.Size + var_count);
+      if constexpr (color_count != 0)
+        g.ColorModifiers.reserve(g.ColorModifiers.Size + color_count);
+      (ec_detail::push_style_entry(entries), ...);
+      TouchStyle();
+    }
+
+    ~StyleScope() {
+      if constexpr (var_count != 0)
+        ImGui::PopStyleVar(var_count);
+      if constexpr (color_count != 0)
+        ImGui::PopStyleColor(color_count);
+      TouchStyle();
+    }
+
+    StyleScope(const StyleScope&) = delete;
+    StyleScope& operator=(const StyleScope&) = delete;
+  };
+
+} // namespace ImGui
@@ -0,0 +1,732 @@
+#pragma once
+
+#include "Input.hpp"
+#include "Style.hpp"
+#include "Window.hpp"
+
+#include <algorithm> // lower_bound, upper_bound
+#include <string.h>  // memcpy, memchr, memmove, strlen
+
+namespace ImGui {
+
+  /// Text stored as a piece table over the loaded text and an append-only
+  /// buffer of inserted text, with the offset of each line start kept up to
+  /// date on every edit. Edits never move the existing text.
+  /// The end offset of every piece is indexed, so reads find their first
+  /// piece with a binary search.
+  class TextDocument {
+  public:
+    TextDocument() {
+      m_line_starts.push_back(0);
+    }
+
+    /// replace the whole text
+    void Load(const char* text, size_t len) {
+      m_original.resize(static_cast<int>(len));
+      if (len != 0)
+        memcpy(m_original.Data, text, len);
+      m_added.resize(0);
+      m_pieces.resize(0);
+      if (len != 0)
+        m_pieces.push_back(Piece {false, 0, len});
+      m_length = len;
+      UpdatePieceEnds(0);
+
+      m_line_starts.resize(0);
+      m_line_starts.push_back(0);
+      const char* p   = text;
+      const char* end = text + len;
+      while ((p = static_cast<const char*>(memchr(p, '\n', end - p)))) {
+        ++p;
+        m_line_starts.push_back(static_cast<size_t>(p - text));
+      }
+    }
+
+    /// number of bytes
+    size_t GetLength() const {
+      return m_length;
+    }
+    int GetLineCount() const {
+      return m_line_starts.Size;
+    }
+    /// offset of the first byte of line
+    size_t GetLineStart(int line) const {
+      return m_line_starts[line];
+    }
+    /// offset of the end of line, excluding '\n'
+    size_t GetLineEnd(int line) const {
+      return line + 1 < m_line_starts.Size ? m_line_starts[line + 1] - 1
+                                           : m_length;
+    }
+    /// line containing offset pos
+    int GetLineOf(size_t pos) const {
+      const size_t* it = std::upper_bound(
+        m_line_starts.begin(), m_line_starts.end(), pos);
+      return static_cast<int>(it - m_line_starts.begin()) - 1;
+    }
+
+    /// byte at pos (pos < GetLength())
+    char GetChar(size_t pos) const {
+      IM_ASSERT(pos < m_length);
+      const int i = PieceAfter(pos);
+      return Source(m_pieces[i])[m_pieces[i].start + pos - PieceStart(i)];
+    }
+
+    /// copies bytes [begin, end) to dst, without terminator
+    void Read(size_t begin, size_t end, char* dst) const {
+      IM_ASSERT(begin <= end && end <= m_length);
+      for (int i = PieceAfter(begin); i < m_pieces.Size && begin < end; ++i) {
+        const Piece& piece     = m_pieces[i];
+        const size_t at        = PieceStart(i);
+        const size_t piece_end = m_piece_ends[i];
+        const size_t b         = begin - at;
+        const size_t e         = (end < piece_end ? end : piece_end) - at;
+        memcpy(dst, Source(piece) + piece.start + b, e - b);
+        dst += e - b;
+        begin = piece_end;
+      }
+    }
+
+    /// Replaces out with bytes [begin, end), null terminated.
+    void CopyRange(size_t begin, size_t end, ImVector<char>& out) const {
+      out.resize(static_cast<int>(end - begin) + 1);
+      Read(begin, end, out.Data);
+      out[out.Size - 1] = '\0';
+    }
+    /// text of line without '\n'
+    void CopyLine(int line, ImVector<char>& out) const {
+      CopyRange(GetLineStart(line), GetLineEnd(line), out);
+    }
+    /// whole text
+    void CopyText(ImVector<char>& out) const {
+      CopyRange(0, m_length, out);
+    }
+
+    /// insert text at pos
+    void Insert(size_t pos, const char* text, size_t len) {
+      IM_ASSERT(pos <= m_length);
+      if (len == 0)
+        return;
+      const size_t add_start = static_cast<size_t>(m_added.Size);
+      m_added.resize(m_added.Size + static_cast<int>(len));
+      memcpy(m_added.Data + add_start, text, len);
+
+      // find piece ending or containing pos
+      const int i = static_cast<int>(
+        std::lower_bound(m_piece_ends.begin(), m_piece_ends.end(), pos) -
+        m_piece_ends.begin());
+      const size_t at = PieceStart(i);
+
+      if (i < m_pieces.Size && at + m_pieces[i].len == pos) {
+        Piece& piece = m_pieces[i];
+        // typing at the end of the last insertion grows its piece
+        if (piece.added && piece.start + piece.len == add_start)
+          piece.len += len;
+        else
+          m_pieces.insert(m_pieces.Data + i + 1, Piece {true, add_start, len});
+      } else if (i < m_pieces.Size && at < pos) {
+        // split piece i around pos
+        const Piece piece = m_pieces[i];
+        const size_t head = pos - at;
+        m_pieces[i].len   = head;
+        m_pieces.insert(
+          m_pieces.Data + i + 1,
+          Piece {piece.added, piece.start + head, piece.len - head});
+        m_pieces.insert(m_pieces.Data + i + 1, Piece {true, add_start, len});
+      } else {
+        m_pieces.insert(m_pieces.Data + i, Piece {true, add_start, len});
+      }
+      m_length += len;
+      UpdatePieceEnds(i);
+
+      // make room for the lines started inside text with one move of the
+      // following lines, shifting them, then fill the room
+      const int line = GetLineOf(pos);
+      int added      = 0;
+      for (size_t k = 0; k < len; ++k)
+        added += text[k] == '\n';
+      const int tail = m_line_starts.Size - (line + 1);
+      m_line_starts.resize(m_line_starts.Size + added);
+      size_t* starts = m_line_starts.Data + line + 1;
+      if (added != 0)
+        memmove(starts + added, starts, tail * sizeof(size_t));
+      for (int l = 0; l < tail; ++l)
+        starts[added + l] += len;
+      for (size_t k = 0; k < len; ++k)
+        if (text[k] == '\n')
+          *starts++ = pos + k + 1;
+    }
+
+    /// erase bytes [pos, pos + len)
+    void Erase(size_t pos, size_t len) {
+      IM_ASSERT(pos + len <= m_length);
+      if (len == 0)
+        return;
+      const size_t end = pos + len;
+
+      const int first_piece = PieceAfter(pos);
+      size_t at             = PieceStart(first_piece);
+      for (int i = first_piece; i < m_pieces.Size && at < end;) {
+        Piece& piece           = m_pieces[i];
+        const size_t piece_end = at + piece.len;
+        if (piece_end <= pos) {
+          at = piece_end;
+          ++i;
+          continue;
+        }
+        const size_t b = pos > at ? pos - at : 0;
+        const size_t e = (end < piece_end ? end : piece_end) - at;
+        if (b == 0 && e == piece.len) {
+          m_pieces.erase(m_pieces.Data + i);
+        } else if (b == 0) {
+          piece.start += e;
+          piece.len -= e;
+          ++i;
+        } else if (e == piece.len) {
+          piece.len = b;
+          ++i;
+        } else {
+          const Piece tail {piece.added, piece.start + e, piece.len - e};
+          piece.len = b;
+          m_pieces.insert(m_pieces.Data + i + 1, tail);
+          i += 2;
+        }
+        at = piece_end;
+      }
+      m_length -= len;
+      UpdatePieceEnds(first_piece);
+
+      // drop lines started inside the erased range, shift the rest
+      const int first = GetLineOf(pos) + 1;
+      int last        = first;
+      while (last < m_line_starts.Size && m_line_starts[last] <= end)
+        ++last;
+      m_line_starts.erase(
+        m_line_starts.Data + first, m_line_starts.Data + last);
+      for (int l = first; l < m_line_starts.Size; ++l)
+        m_line_starts[l] -= len;
+    }
+
+  private:
+    struct Piece {
+      bool added; // in m_added, else in m_original
+      size_t start;
+      size_t len;
+    };
+
+    const char* Source(const Piece& piece) const {
+      return piece.added ? m_added.Data : m_original.Data;
+    }
+
+    /// index of the piece holding pos (pos < GetLength())
+    int PieceAfter(size_t pos) const {
+      return static_cast<int>(
+        std::upper_bound(m_piece_ends.begin(), m_piece_ends.end(), pos) -
+        m_piece_ends.begin());
+    }
+    /// offset of the first byte of piece i
+    size_t PieceStart(int i) const {
+      return i != 0 ? m_piece_ends[i - 1] : 0;
+    }
+    /// recomputes the piece end offsets from piece first on
+    void UpdatePieceEnds(int first) {
+      m_piece_ends.resize(m_pieces.Size);
+      size_t at = PieceStart(first);
+      for (int i = first; i < m_pieces.Size; ++i) {
+        at += m_pieces[i].len;
+        m_piece_ends[i] = at;
+      }
+    }
+
+    ImVector<char> m_original;
+    ImVector<char> m_added;
+    ImVector<Piece> m_pieces;
+    ImVector<size_t> m_piece_ends; // offset after each piece
+    ImVector<size_t> m_line_starts;
+    size_t m_length = 0;
+  };
+
+  /// Undo/redo history of a TextDocument: each edit keeps the bytes it
+  /// erased and inserted, so undoing costs the size of the edit only.
+  /// Clear() it when the document is replaced with TextDocument::Load().
+  class TextEditHistory {
+  public:
+    /// Records the replacement of [pos, pos + erase_len) of doc by text,
+    /// before it is applied. Consecutive typing is undone as one edit.
+    void Record(
+      const TextDocument& doc,
+      size_t pos,
+      size_t erase_len,
+      const char* text,
+      size_t len,
+      bool typing) {
+      // a new edit drops the undone ones
+      if (m_done < m_edits.Size) {
+        m_text.resize(static_cast<int>(m_edits[m_done].text));
+        m_edits.resize(m_done);
+      }
+      if (typing && m_done != 0) {
+        Edit& last = m_edits[m_done - 1];
+        if (last.typing && last.erased == 0 && erase_len == 0 &&
+            last.pos + last.inserted == pos) {
+          Append(text, len);
+          last.inserted += len;
+          return;
+        }
+      }
+      const Edit edit = {
+        pos, erase_len, len, static_cast<size_t>(m_text.Size), typing};
+      m_text.resize(m_text.Size + static_cast<int>(erase_len));
+      doc.Read(pos, pos + erase_len, m_text.Data + edit.text);
+      Append(text, len);
+      m_edits.push_back(edit);
+      m_done = m_edits.Size;
+    }
+
+    bool CanUndo() const {
+      return m_done != 0;
+    }
+    bool CanRedo() const {
+      return m_done < m_edits.Size;
+    }
+
+    /// reverts the last edit, cursor is set after the restored text
+    bool Undo(TextDocument& doc, size_t& cursor) {
+      if (!CanUndo())
+        return false;
+      const Edit& e = m_edits[--m_done];
+      doc.Erase(e.pos, e.inserted);
+      doc.Insert(e.pos, m_text.Data + e.text, e.erased);
+      cursor = e.pos + e.erased;
+      return true;
+    }
+
+    /// applies the last undone edit again
+    bool Redo(TextDocument& doc, size_t& cursor) {
+      if (!CanRedo())
+        return false;
+      const Edit& e = m_edits[m_done++];
+      doc.Erase(e.pos, e.erased);
+      doc.Insert(e.pos, m_text.Data + e.text + e.erased, e.inserted);
+      cursor = e.pos + e.inserted;
+      return true;
+    }
+
+    void Clear() {
+      m_edits.resize(0);
+      m_text.resize(0);
+      m_done = 0;
+    }
+
+  private:
+    struct Edit {
+      size_t pos;
+      size_t erased;   // bytes at m_text[text]
+      size_t inserted; // bytes at m_text[text + erased]
+      size_t text;
+      bool typing;
+    };
+
+    void Append(const char* text, size_t len) {
+      const int at = m_text.Size;
+      m_text.resize(at + static_cast<int>(len));
+      if (len != 0)
+        memcpy(m_text.Data + at, text, len);
+    }
+
+    ImVector<Edit> m_edits;
+    ImVector<char> m_text;
+    int m_done = 0; // edits [0, m_done) are applied
+  };
+
+  /// Cursor, selection, history and scratch memory of a TextEditor() widget.
+  struct TextEditorState {
+    size_t cursor         = 0; // byte offset
+    size_t anchor         = 0; // other end of the selection
+    bool scroll_to_cursor = false;
+    bool selecting        = false; // mouse button held since a click
+    TextEditHistory history;
+    ImVector<char> line;
+
+    bool HasSelection() const {
+      return cursor != anchor;
+    }
+    size_t SelectionBegin() const {
+      return cursor < anchor ? cursor : anchor;
+    }
+    size_t SelectionEnd() const {
+      return cursor < anchor ? anchor : cursor;
+    }
+  };
+
+  namespace ec_detail {
+    inline bool is_utf8_continuation(char c) {
+      return (static_cast<unsigned char>(c) & 0xC0) == 0x80;
+    }
+
+    /// UTF-8 of c, returns length
+    inline int encode_utf8(char* out, unsigned int c) {
+      if (c < 0x80) {
+        out[0] = static_cast<char>(c);
+        return 1;
+      }
+      if (c < 0x800) {
+        out[0] = static_cast<char>(0xC0 | (c >> 6));
+        out[1] = static_cast<char>(0x80 | (c & 0x3F));
+        return 2;
+      }
+      out[0] = static_cast<char>(0xE0 | (c >> 12));
+      out[1] = static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+      out[2] = static_cast<char>(0x80 | (c & 0x3F));
+      return 3;
+    }
+
+    /// pos moved back to the first byte of its UTF-8 sequence
+    inline size_t utf8_floor(const TextDocument& doc, size_t pos) {
+      while (pos > 0 && pos < doc.GetLength() &&
+             is_utf8_continuation(doc.GetChar(pos)))
+        --pos;
+      return pos;
+    }
+    /// start of the character before pos (pos > 0)
+    inline size_t utf8_prev(const TextDocument& doc, size_t pos) {
+      return utf8_floor(doc, pos - 1);
+    }
+    /// start of the character after pos (pos < doc.GetLength())
+    inline size_t utf8_next(const TextDocument& doc, size_t pos) {
+      do
+        ++pos;
+      while (pos < doc.GetLength() && is_utf8_continuation(doc.GetChar(pos)));
+      return pos;
+    }
+
+    inline bool text_key_pressed(Key key) {
+      return ImGui::IsKeyPressed(ImGui::GetKeyIndex(key));
+    }
+
+    /// Applies keyboard input to doc, returns true when text changed.
+    /// page_lines is the number of lines moved by PageUp and PageDown.
+    inline bool text_editor_keys(
+      TextDocument& doc,
+      TextEditorState& state,
+      InputTextFlags flags,
+      int page_lines) {
+      ImGuiIO& io          = ImGui::GetIO();
+      const bool read_only = has_any(flags, InputTextFlags::ReadOnly);
+      const bool undo =
+        !read_only && !has_any(flags, InputTextFlags::NoUndoRedo);
+      // same modifiers as InputTextMultiline()
+      const bool shortcut =
+        (io.ConfigMacOSXBehaviors ? io.KeySuper : io.KeyCtrl) && !io.KeyAlt;
+      size_t& cursor = state.cursor;
+      bool changed   = false;
+      bool moved     = false;
+
+      auto move = [&](size_t to) {
+        cursor = to;
+        if (!io.KeyShift)
+          state.anchor = to;
+        moved = true;
+      };
+      auto replace = [&](
+                       size_t begin, size_t end, const char* text, size_t len,
+                       bool typing) {
+        if (begin == end && len == 0)
+          return;
+        if (undo)
+          state.history.Record(doc, begin, end - begin, text, len, typing);
+        doc.Erase(begin, end - begin);
+        doc.Insert(begin, text, len);
+        cursor = state.anchor = begin + len;
+        changed               = true;
+      };
+      auto insert = [&](const char* text, size_t len, bool typing) {
+        replace(
+          state.SelectionBegin(), state.SelectionEnd(), text, len, typing);
+      };
+      auto vertical = [&](int lines) {
+        const int line   = doc.GetLineOf(cursor);
+        int target       = line + lines;
+        target           = target < 0 ? 0 : target;
+        const int last   = doc.GetLineCount() - 1;
+        target           = target > last ? last : target;
+        const size_t col = cursor - doc.GetLineStart(line);
+        const size_t b   = doc.GetLineStart(target);
+        const size_t e   = doc.GetLineEnd(target);
+        move(utf8_floor(doc, b + col < e ? b + col : e));
+      };
+
+      // a selection collapses to its side unless Shift extends it
+      if (text_key_pressed(Key::LeftArrow)) {
+        if (state.HasSelection() && !io.KeyShift)
+          move(state.SelectionBegin());
+        else if (cursor > 0)
+          move(utf8_prev(doc, cursor));
+      }
+      if (text_key_pressed(Key::RightArrow)) {
+        if (state.HasSelection() && !io.KeyShift)
+          move(state.SelectionEnd());
+        else if (cursor < doc.GetLength())
+          move(utf8_next(doc, cursor));
+      }
+      if (text_key_pressed(Key::UpArrow))
+        vertical(-1);
+      if (text_key_pressed(Key::DownArrow))
+        vertical(1);
+      if (text_key_pressed(Key::PageUp))
+        vertical(-page_lines);
+      if (text_key_pressed(Key::PageDown))
+        vertical(page_lines);
+      if (text_key_pressed(Key::Home))
+        move(io.KeyCtrl ? 0 : doc.GetLineStart(doc.GetLineOf(cursor)));
+      if (text_key_pressed(Key::End))
+        move(
+          io.KeyCtrl ? doc.GetLength() : doc.GetLineEnd(doc.GetLineOf(cursor)));
+      if (shortcut && text_key_pressed(Key::A)) {
+        state.anchor = 0;
+        cursor       = doc.GetLength();
+        moved        = true;
+      }
+
+      // clipboard
+      const bool copy = shortcut && text_key_pressed(Key::C);
+      const bool cut  = shortcut && text_key_pressed(Key::X);
+      if ((copy || cut) && state.HasSelection()) {
+        doc.CopyRange(state.SelectionBegin(), state.SelectionEnd(), state.line);
+        ImGui::SetClipboardText(state.line.Data);
+        if (cut && !read_only)
+          insert("", 0, false);
+      }
+
+      if (!read_only) {
+        if (undo && shortcut && text_key_pressed(Key::Z)) {
+          const bool redo = io.KeyShift;
+          if (redo ? state.history.Redo(doc, cursor)
+                   : state.history.Undo(doc, cursor)) {
+            state.anchor = cursor;
+            changed      = true;
+          }
+        }
+        if (undo && shortcut && text_key_pressed(Key::Y) &&
+            state.history.Redo(doc, cursor)) {
+          state.anchor = cursor;
+          changed      = true;
+        }
+
+        if (text_key_pressed(Key::Backspace)) {
+          if (state.HasSelection())
+            insert("", 0, false);
+          else if (cursor > 0)
+            replace(utf8_prev(doc, cursor), cursor, "", 0, false);
+        }
+        if (text_key_pressed(Key::Delete)) {
+          if (state.HasSelection())
+            insert("", 0, false);
+          else if (cursor < doc.GetLength())
+            replace(cursor, utf8_next(doc, cursor), "", 0, false);
+        }
+        // same meaning of Enter as InputTextMultiline()
+        const bool ctrl_enter_for_new_line =
+          has_any(flags, InputTextFlags::CtrlEnterForNewLine);
+        if (
+          text_key_pressed(Key::Enter) &&
+          io.KeyCtrl == ctrl_enter_for_new_line)
+          insert("\n", 1, false);
+        const bool tab_input = has_any(flags, InputTextFlags::AllowTabInput);
+        if (text_key_pressed(Key::Tab) && tab_input && !io.KeyCtrl)
+          insert("\t", 1, false);
+
+        // pasted and typed text goes through the same filter
+        const bool uppercase = has_any(flags, InputTextFlags::CharsUppercase);
+        auto accept          = [&](unsigned int& c) {
+          if (c == '\t')
+            return tab_input;
+          if (c < 0x20 && c != '\n')
+            return false;
+          if (c == 0x7F)
+            return false;
+          if (uppercase && c >= 'a' && c <= 'z')
+            c += 'A' - 'a';
+          return true;
+        };
+        if (shortcut && text_key_pressed(Key::V)) {
+          if (const char* clipboard = ImGui::GetClipboardText()) {
+            state.line.resize(0);
+            for (const char* p = clipboard; *p; ++p) {
+              unsigned int c = static_cast<unsigned char>(*p);
+              if (accept(c))
+                state.line.push_back(static_cast<char>(c));
+            }
+            const size_t len = static_cast<size_t>(state.line.Size);
+            insert(state.line.Data, len, false);
+          }
+        }
+
+        // characters typed with a shortcut modifier are commands
+        const bool ignore_chars = (io.KeyCtrl && !io.KeyAlt) ||
+                                  (io.ConfigMacOSXBehaviors && io.KeySuper);
+        for (int i = 0; !ignore_chars && io.InputCharacters[i] != 0; ++i) {
+          unsigned int c = io.InputCharacters[i];
+          if (c == '\n' || c == '\t' || !accept(c))
+            continue; // handled as keys
+          char utf8[4];
+          insert(utf8, static_cast<size_t>(encode_utf8(utf8, c)), true);
+        }
+      }
+
+      if (moved || changed)
+        state.scroll_to_cursor = true;
+      return changed;
+    }
+
+    /// byte offset in line closest to x
+    inline size_t text_column_at(const char* b, const char* e, float x) {
+      const char* p = b;
+      while (p < e) {
+        const char* next = p + 1;
+        while (next < e && is_utf8_continuation(*next))
+          ++next;
+        const float w = ImGui::CalcTextSize(p, next).x;
+        if (x < w * 0.5f)
+          break;
+        x -= w;
+        p = next;
+      }
+      return static_cast<size_t>(p - b);
+    }
+
+    /// offset of the character under point, origin being the top left of
+    /// the first line
+    inline size_t text_offset_at(
+      const TextDocument& doc,
+      ImVector<char>& scratch,
+      const ImVec2& origin,
+      float line_height,
+      const ImVec2& point) {
+      int line = static_cast<int>((point.y - origin.y) / line_height);
+      line     = line < 0 ? 0 : line;
+      line = line < doc.GetLineCount() ? line : doc.GetLineCount() - 1;
+      doc.CopyLine(line, scratch);
+      const char* b = scratch.Data;
+      const char* e = b + scratch.Size - 1;
+      return doc.GetLineStart(line) + text_column_at(b, e, point.x - origin.x);
+    }
+  } // namespace ec_detail
+
+  /// Multiline editor over a TextDocument which only lays out the visible
+  /// lines, so its cost does not depend on document size.
+  /// Supports mouse and Shift selection, the clipboard (Ctrl+A/C/X/V),
+  /// undo (Ctrl+Z, Ctrl+Y or Ctrl+Shift+Z) and PageUp/PageDown.
+  /// Honors ReadOnly, AllowTabInput, CtrlEnterForNewLine, CharsUppercase
+  /// and NoUndoRedo. Returns true when the text was edited.
+  inline bool TextEditor(
+    const char* label,
+    TextDocument& doc,
+    TextEditorState& state,
+    const ImVec2& size   = ImVec2(0, 0),
+    InputTextFlags flags = InputTextFlags::None) {
+    const size_t length = doc.GetLength();
+    state.cursor        = state.cursor < length ? state.cursor : length;
+    state.anchor        = state.anchor < length ? state.anchor : length;
+
+    ImGui::BeginChild(label, size, true, WindowFlags::HorizontalScrollbar);
+    ImGui::PushStyleVar(
+      StyleVar::ItemSpacing, ImVec2(ImGui::GetStyle().ItemSpacing.x, 0.0f));
+
+    const float line_height = ImGui::GetTextLineHeight();
+    const float view_height =
+      ImGui::GetWindowHeight() - ImGui::GetStyle().WindowPadding.y * 2;
+    const ImVec2 origin = ImGui::GetCursorScreenPos();
+    const ImVec2 mouse  = ImGui::GetMousePos();
+    // right and bottom of the text area, left of the scrollbars
+    const ImVec2 window_pos  = ImGui::GetWindowPos();
+    const ImVec2 content_max = ImGui::GetWindowContentRegionMax();
+    const ImVec2 padding     = ImGui::GetStyle().WindowPadding;
+    const ImVec2 text_max(
+      window_pos.x + content_max.x + padding.x,
+      window_pos.y + content_max.y + padding.y);
+
+    // a click places the cursor (Shift+click extends the selection) and
+    // dragging selects
+    if (
+      ImGui::IsWindowHovered() && ImGui::IsMouseClicked(0) &&
+      mouse.x < text_max.x && mouse.y < text_max.y) {
+      state.cursor = ec_detail::text_offset_at(
+        doc, state.line, origin, line_height, mouse);
+      if (!ImGui::GetIO().KeyShift)
+        state.anchor = state.cursor;
+      state.selecting = true;
+    } else if (state.selecting) {
+      state.selecting = ImGui::IsMouseDown(0);
+      if (state.selecting) {
+        state.cursor = ec_detail::text_offset_at(
+          doc, state.line, origin, line_height, mouse);
+        state.scroll_to_cursor = true;
+      }
+    }
+
+    bool changed = false;
+    if (ImGui::IsWindowFocused()) {
+      ImGui::CaptureKeyboardFromApp(true);
+      const int page_lines = static_cast<int>(view_height / line_height);
+      changed              = ec_detail::text_editor_keys(
+        doc, state, flags, page_lines > 1 ? page_lines : 1);
+    }
+
+    const int cursor_line     = doc.GetLineOf(state.cursor);
+    const size_t select_begin = state.SelectionBegin();
+    const size_t select_end   = state.SelectionEnd();
+    const ImU32 select_col    = ImGui::GetColorU32(Col::TextSelectedBg);
+    const float newline_width = ImGui::CalcTextSize(" ").x;
+    ImDrawList* draw_list     = ImGui::GetWindowDrawList();
+
+    ImGuiListClipper clipper(doc.GetLineCount(), line_height);
+    while (clipper.Step()) {
+      for (int line = clipper.DisplayStart; line < clipper.DisplayEnd; ++line) {
+        doc.CopyLine(line, state.line);
+        const char* b      = state.line.Data;
+        const char* e      = b + state.line.Size - 1;
+        const ImVec2 pos   = ImGui::GetCursorScreenPos();
+        const size_t start = doc.GetLineStart(line);
+        const size_t end   = start + static_cast<size_t>(e - b);
+
+        // selected part of the line, plus its '\n' when selected
+        if (select_begin < select_end && select_begin <= end &&
+            select_end > start) {
+          const size_t from = select_begin > start ? select_begin - start : 0;
+          const size_t to   = (select_end < end ? select_end : end) - start;
+          const float x0    = pos.x + ImGui::CalcTextSize(b, b + from).x;
+          float x1          = pos.x + ImGui::CalcTextSize(b, b + to).x;
+          if (select_end > end)
+            x1 += newline_width;
+          draw_list->AddRectFilled(
+            ImVec2(x0, pos.y), ImVec2(x1, pos.y + line_height), select_col);
+        }
+        ImGui::TextUnformatted(b, e);
+
+        if (line == cursor_line && ImGui::IsWindowFocused()) {
+          const size_t column = state.cursor - start;
+          const float x       = pos.x + ImGui::CalcTextSize(b, b + column).x;
+          draw_list->AddLine(
+            ImVec2(x, pos.y), ImVec2(x, pos.y + line_height),
+            ImGui::GetColorU32(Col::Text));
+        }
+      }
+    }
+
+    if (state.scroll_to_cursor) {
+      const float y      = cursor_line * line_height;
+      const float scroll = ImGui::GetScrollY();
+      if (y < scroll)
+        ImGui::SetScrollY(y);
+      else if (y + line_height > scroll + view_height)
+        ImGui::SetScrollY(y + line_height - view_height);
+      state.scroll_to_cursor = false;
+    }
+
+    ImGui::PopStyleVar();
+    ImGui::EndChild();
+    return changed;
+  }
+
+} // namespace ImGui
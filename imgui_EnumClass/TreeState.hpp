@@ -0,0 +1,312 @@
+#pragma once
+
+#include "Widgets.hpp"
+
+#include <imgui_internal.h> // GetCurrentWindowRead
+#include <stdint.h> // uintptr_t
+#include <string.h> // memcpy, memset
+
+namespace ImGui {
+
+  /// Open state of tree nodes keyed by ptr_id, with O(1) lookup and O(1)
+  /// expand/collapse of a whole subtree.
+  /// Subtree changes are stamped and applied lazily to descendants when they
+  /// are submitted under the changed node, so expanding a huge tree costs
+  /// nothing until its nodes are drawn.
+  /// ```
+  /// static ImGui::TreeState state;
+  /// auto flags = ImGui::TreeNodeFlags::OpenOnArrow;
+  /// if (state.TreeNodeEx(node, flags, "%s", name)) {
+  ///   ...
+  ///   state.TreePop();
+  /// }
+  /// state.SetSubtreeOpen(root, true); // expand all
+  /// ```
+  class TreeState {
+  public:
+    TreeState()
+      : m_entries(nullptr)
+      , m_capacity(0)
+      , m_size(0)
+      , m_epoch(0) {
+      m_root_override.stamp = 0;
+      m_root_override.open  = false;
+    }
+    ~TreeState() {
+      ImGui::MemFree(m_entries);
+    }
+
+    TreeState(const TreeState&) = delete;
+    TreeState& operator=(const TreeState&) = delete;
+
+    /// TreeNodeEx() whose open state is kept in this store.
+    /// Call TreeState::TreePop() instead of ImGui::TreePop() when it returns
+    /// true (unless NoTreePushOnOpen is set).
+    template <class... Args>
+    bool TreeNodeEx(
+      const void* ptr_id,
+      TreeNodeFlags flags,
+      const char* fmt,
+      Args&&... args) {
+      Entry& e = Resolve(ptr_id, flags);
+      // a collapsed or clipped-out window returns false without reading
+      // the node, which must not be taken as a close
+      const bool submitted = !ImGui::GetCurrentWindowRead()->SkipItems;
+      if (submitted)
+        ImGui::SetNextTreeNodeOpen(e.open, ImGuiCond_Always);
+      const bool open =
+        ImGui::TreeNodeEx(ptr_id, flags, fmt, std::forward<Args>(args)...);
+      if (submitted && open != e.open) {
+        e.open  = open;
+        e.stamp = ++m_epoch;
+      }
+      if (open && !ec_detail::has_any(flags, TreeNodeFlags::NoTreePushOnOpen))
+        m_stack.push_back(Inherited(e));
+      return open;
+    }
+
+    /// pop a node opened by TreeNodeEx()
+    void TreePop() {
+      IM_ASSERT(!m_stack.empty() && "TreeState::TreePop() without node");
+      m_stack.pop_back();
+      ImGui::TreePop();
+    }
+
+    /// open state of ptr_id, or default_open when it was never submitted
+    bool IsOpen(const void* ptr_id, bool default_open = false) const {
+      const Entry* e = Find(ptr_id);
+      return e ? e->open : default_open;
+    }
+
+    /// set open state of one node
+    void SetOpen(const void* ptr_id, bool open) {
+      Entry& e = Insert(ptr_id, open);
+      e.open   = open;
+      e.stamp  = ++m_epoch;
+    }
+
+    /// set open state of a node and all of its descendants
+    void SetSubtreeOpen(const void* ptr_id, bool open) {
+      Entry& e        = Insert(ptr_id, open);
+      e.open          = open;
+      e.stamp         = ++m_epoch;
+      e.subtree.open  = open;
+      e.subtree.stamp = e.stamp;
+    }
+
+    /// set open state of every node
+    void SetAllOpen(bool open) {
+      m_root_override.open  = open;
+      m_root_override.stamp = ++m_epoch;
+    }
+
+    /// forget all nodes
+    void Clear() {
+      if (m_entries)
+        memset(m_entries, 0, m_capacity * sizeof(Entry));
+      m_size                = 0;
+      m_root_override.stamp = 0;
+      m_root_override.open  = false;
+      m_stack.resize(0);
+    }
+
+    /// Appends the state as a binary blob. Keys are stored as pointer
+    /// values, so they should be stable ids rather than addresses when the
+    /// blob outlives the process.
+    void Save(ImVector<unsigned char>& out) const {
+      const ImU32 header[3] = {
+        kMagic, static_cast<ImU32>(m_size), m_epoch};
+      Append(out, header, sizeof(header));
+      AppendOverride(out, m_root_override);
+      for (ImU32 i = 0; i < m_capacity; ++i) {
+        const Entry& e = m_entries[i];
+        if (!e.key)
+          continue;
+        const ImU64 key          = reinterpret_cast<uintptr_t>(e.key);
+        const unsigned char open = e.open;
+        Append(out, &key, sizeof(key));
+        Append(out, &e.stamp, sizeof(e.stamp));
+        Append(out, &open, sizeof(open));
+        AppendOverride(out, e.subtree);
+      }
+    }
+
+    /// Restores a blob written by Save(). Returns false (leaving the store
+    /// empty) when the blob is malformed.
+    bool Load(const void* data, size_t size) {
+      Clear();
+      const unsigned char* p   = static_cast<const unsigned char*>(data);
+      const unsigned char* end = p + size;
+      ImU32 header[3];
+      if (!Read(p, end, header, sizeof(header)) || header[0] != kMagic)
+        return false;
+      Override root;
+      if (!ReadOverride(p, end, root))
+        return false;
+      for (ImU32 i = 0; i < header[1]; ++i) {
+        ImU64 key;
+        ImU32 stamp;
+        Override subtree;
+        unsigned char open;
+        if (
+          !Read(p, end, &key, sizeof(key)) ||
+          !Read(p, end, &stamp, sizeof(stamp)) ||
+          !Read(p, end, &open, sizeof(open)) ||
+          !ReadOverride(p, end, subtree) || key == 0) {
+          Clear();
+          return false;
+        }
+        Entry& e = Insert(
+          reinterpret_cast<const void*>(static_cast<uintptr_t>(key)), false);
+        e.open    = open != 0;
+        e.stamp   = stamp;
+        e.subtree = subtree;
+      }
+      m_root_override = root;
+      m_epoch         = header[2];
+      return true;
+    }
+
+    /// number of stored nodes
+    int GetSize() const {
+      return static_cast<int>(m_size);
+    }
+
+  private:
+    static constexpr ImU32 kMagic = 0x53545345; // "ESTS"
+
+    /// open state applied to descendants changed before stamp
+    struct Override {
+      ImU32 stamp;
+      bool open;
+    };
+
+    struct Entry {
+      const void* key; // null: empty slot
+      ImU32 stamp;     // epoch of the last change of open
+      Override subtree;
+      bool open;
+    };
+
+    static ImU32 Hash(const void* key) {
+      ImU64 x = static_cast<ImU64>(reinterpret_cast<uintptr_t>(key));
+      x ^= x >> 33;
+      x *= 0xFF51AFD7ED558CCDull;
+      x ^= x >> 33;
+      return static_cast<ImU32>(x);
+    }
+
+    Entry* Find(const void* key) const {
+      if (m_capacity == 0)
+        return nullptr;
+      const ImU32 mask = m_capacity - 1;
+      for (ImU32 i = Hash(key) & mask;; i = (i + 1) & mask) {
+        Entry& e = m_entries[i];
+        if (e.key == key)
+          return &e;
+        if (!e.key)
+          return nullptr;
+      }
+    }
+
+    /// entry of key, created with open when missing
+    Entry& Insert(const void* key, bool open) {
+      IM_ASSERT(key && "TreeState does not take null ptr_id");
+      if (Entry* e = Find(key))
+        return *e;
+      if ((m_size + 1) * 4 > m_capacity * 3)
+        Grow();
+      const ImU32 mask = m_capacity - 1;
+      ImU32 i          = Hash(key) & mask;
+      while (m_entries[i].key)
+        i = (i + 1) & mask;
+      Entry& e        = m_entries[i];
+      e.key           = key;
+      e.stamp         = 0;
+      e.subtree.stamp = 0;
+      e.subtree.open  = false;
+      e.open          = open;
+      ++m_size;
+      return e;
+    }
+
+    void Grow() {
+      Entry* old           = m_entries;
+      const ImU32 old_size = m_capacity;
+      m_capacity           = m_capacity ? m_capacity * 2 : 256;
+      m_entries =
+        static_cast<Entry*>(ImGui::MemAlloc(m_capacity * sizeof(Entry)));
+      memset(m_entries, 0, m_capacity * sizeof(Entry));
+      const ImU32 mask = m_capacity - 1;
+      for (ImU32 j = 0; j < old_size; ++j) {
+        if (!old[j].key)
+          continue;
+        ImU32 i = Hash(old[j].key) & mask;
+        while (m_entries[i].key)
+          i = (i + 1) & mask;
+        m_entries[i] = old[j];
+      }
+      ImGui::MemFree(old);
+    }
+
+    /// newest override from the ancestors of the node being submitted
+    Override Current() const {
+      return m_stack.empty() ? m_root_override : m_stack.back();
+    }
+
+    /// override children of e inherit
+    Override Inherited(const Entry& e) const {
+      const Override parent = Current();
+      return e.subtree.stamp > parent.stamp ? e.subtree : parent;
+    }
+
+    /// entry of ptr_id with pending subtree changes applied
+    Entry& Resolve(const void* ptr_id, TreeNodeFlags flags) {
+      Entry& e = Insert(
+        ptr_id, ec_detail::has_any(flags, TreeNodeFlags::DefaultOpen));
+      const Override parent = Current();
+      if (parent.stamp > e.stamp) {
+        e.open  = parent.open;
+        e.stamp = parent.stamp;
+      }
+      return e;
+    }
+
+    static void Append(ImVector<unsigned char>& out, const void* p, size_t n) {
+      const int size = out.Size;
+      out.resize(size + static_cast<int>(n));
+      memcpy(out.Data + size, p, n);
+    }
+    static bool Read(
+      const unsigned char*& p, const unsigned char* end, void* dst, size_t n) {
+      if (static_cast<size_t>(end - p) < n)
+        return false;
+      memcpy(dst, p, n);
+      p += n;
+      return true;
+    }
+    static void AppendOverride(ImVector<unsigned char>& out, Override o) {
+      const unsigned char open = o.open;
+      Append(out, &o.stamp, sizeof(o.stamp));
+      Append(out, &open, sizeof(open));
+    }
+    static bool ReadOverride(
+      const unsigned char*& p, const unsigned char* end, Override& o) {
+      unsigned char open;
+      if (
+        !Read(p, end, &o.stamp, sizeof(o.stamp)) ||
+        !Read(p, end, &open, sizeof(open)))
+        return false;
+      o.open = open != 0;
+      return true;
+    }
+
+    Entry* m_entries;
+    ImU32 m_capacity; // power of two
+    ImU32 m_size;
+    ImU32 m_epoch;
+    Override m_root_override;
+    ImVector<Override> m_stack;
+  };
+
+} // namespace ImGui
@@ -0,0 +1,193 @@
+#pragma once
+
+#include "Widgets.hpp"
+
+#include <algorithm> // lower_bound
+#include <stdint.h>  // intptr_t
+#include <string.h>  // memmove
+
+namespace ImGui {
+
+  /// Calls draw_row(index) for the rows of [0, count) which are on screen.
+  /// All rows should have the same height.
+  template <class DrawRow>
+  void VirtualList(int count, DrawRow&& draw_row) {
+    ImGuiListClipper clipper(count);
+    while (clipper.Step())
+      for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; ++i)
+        draw_row(i);
+  }
+
+  /// List of selectables where only the visible rows are submitted.
+  /// label(index) returns the text of a row. Returns true when *current
+  /// changed.
+  template <class Label>
+  bool VirtualSelectableList(
+    int count,
+    int* current,
+    Label&& label,
+    SelectableFlags flags = SelectableFlags::None) {
+    bool changed = false;
+    VirtualList(count, [&](int i) {
+      ImGui::PushID(i);
+      if (ImGui::Selectable(label(i), *current == i, flags)) {
+        *current = i;
+        changed  = true;
+      }
+      ImGui::PopID();
+    });
+    return changed;
+  }
+
+  /// Tree of which only the on-screen rows are submitted.
+  /// Nodes are given in depth-first order with their depth. The list of
+  /// visible nodes is kept up to date incrementally when a node is opened or
+  /// closed, so drawing costs the same for any number of nodes.
+  class VirtualTree {
+  public:
+    /// depth[i] is the depth of node i (roots are 0). Closes every node.
+    void SetNodes(const int* depth, int count) {
+      m_depth.resize(count);
+      m_end.resize(count);
+      m_open.resize(count);
+      if (count != 0)
+        memcpy(m_depth.Data, depth, count * sizeof(int));
+
+      // end of each subtree: next node which is not deeper
+      ImVector<int>& stack = m_scratch;
+      stack.resize(0);
+      for (int i = 0; i < count; ++i) {
+        m_open[i] = false;
+        while (!stack.empty() && m_depth[stack.back()] >= depth[i]) {
+          m_end[stack.back()] = i;
+          stack.pop_back();
+        }
+        stack.push_back(i);
+      }
+      for (int node : stack)
+        m_end[node] = count;
+
+      m_rows.resize(0);
+      for (int i = 0; i < count; i = m_end[i])
+        m_rows.push_back(i);
+    }
+
+    int GetNodeCount() const {
+      return m_depth.Size;
+    }
+    /// number of visible nodes
+    int GetRowCount() const {
+      return m_rows.Size;
+    }
+    /// node shown at row
+    int GetRowNode(int row) const {
+      return m_rows[row];
+    }
+
+    bool IsOpen(int node) const {
+      return m_open[node];
+    }
+    bool IsLeaf(int node) const {
+      return m_end[node] == node + 1;
+    }
+
+    /// Opens or closes node, inserting or removing the rows of its visible
+    /// descendants.
+    void SetOpen(int node, bool open) {
+      if (m_open[node] == open)
+        return;
+      m_open[node] = open;
+
+      const int row = FindRow(node);
+      if (row < 0) // hidden by a closed ancestor
+        return;
+
+      if (!open) {
+        int* first = m_rows.Data + row + 1;
+        int* last  = std::lower_bound(first, m_rows.end(), m_end[node]);
+        m_rows.erase(first, last);
+        return;
+      }
+
+      ImVector<int>& rows = m_scratch;
+      rows.resize(0);
+      for (int i = node + 1; i < m_end[node]; i = m_open[i] ? i + 1 : m_end[i])
+        rows.push_back(i);
+      if (rows.empty())
+        return;
+
+      const int tail = m_rows.Size - (row + 1);
+      m_rows.resize(m_rows.Size + rows.Size);
+      memmove(
+        m_rows.Data + row + 1 + rows.Size, m_rows.Data + row + 1,
+        tail * sizeof(int));
+      memcpy(m_rows.Data + row + 1, rows.Data, rows.Size * sizeof(int));
+    }
+
+    /// Submits the on-screen rows as tree nodes.
+    /// label(node) returns the text of a node. Nodes without children get
+    /// Leaf instead of OpenOnArrow and OpenOnDoubleClick, *selected gets
+    /// Selected, and a click on a node which does not toggle it stores it
+    /// to *selected.
+    template <class Label>
+    void Draw(
+      Label&& label,
+      TreeNodeFlags flags = TreeNodeFlags::OpenOnArrow,
+      int* selected       = NULL) {
+      const float indent = ImGui::GetStyle().IndentSpacing;
+      int toggled        = -1;
+
+      ImGuiListClipper clipper(m_rows.Size);
+      while (clipper.Step()) {
+        for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row) {
+          const int node  = m_rows[row];
+          const int depth = m_depth[node];
+
+          const bool leaf          = IsLeaf(node);
+          TreeNodeFlags node_flags = flags | TreeNodeFlags::NoTreePushOnOpen;
+          // leaves cannot open, so they drop the open triggers
+          if (leaf)
+            node_flags = (node_flags & ~(TreeNodeFlags::OpenOnArrow |
+                                         TreeNodeFlags::OpenOnDoubleClick)) |
+                         TreeNodeFlags::Leaf;
+          if (selected && *selected == node)
+            node_flags |= TreeNodeFlags::Selected;
+
+          if (depth != 0)
+            ImGui::Indent(depth * indent);
+          ImGui::SetNextTreeNodeOpen(m_open[node], ImGuiCond_Always);
+          const bool open = ImGui::TreeNodeEx(
+            reinterpret_cast<void*>(static_cast<intptr_t>(node)), node_flags,
+            "%s", label(node));
+          // leaves are always reported open, whatever m_open holds
+          if (!leaf && open != m_open[node])
+            toggled = node;
+          else if (selected && ImGui::IsItemClicked())
+            *selected = node;
+          if (depth != 0)
+            ImGui::Unindent(depth * indent);
+        }
+      }
+
+      // rows may move, so apply after the loop
+      if (toggled >= 0)
+        SetOpen(toggled, !m_open[toggled]);
+    }
+
+  private:
+    /// row of node, or -1 when it is not visible
+    int FindRow(int node) const {
+      const int* it = std::lower_bound(m_rows.begin(), m_rows.end(), node);
+      return it != m_rows.end() && *it == node
+               ? static_cast<int>(it - m_rows.begin())
+               : -1;
+    }
+
+    ImVector<int> m_depth;
+    ImVector<int> m_end; // one past the last node of the subtree
+    ImVector<bool> m_open;
+    ImVector<int> m_rows; // visible nodes, ascending
+    ImVector<int> m_scratch;
+  };
+
+} // namespace ImGui
@@ -0,0 +1,429 @@
+#pragma once
+
+#include "Flags.hpp"
+
+#include <string.h> // strchr, strlen
+#include <utility>  // forward
+
+namespace ImGui {
+
+  // ----------------------------------------
+  // Dir
+
+  /// ImGuiDir
+  enum class Dir : int {
+    None  = ImGuiDir_None,
+    Left  = ImGuiDir_Left,
+    Right = ImGuiDir_Right,
+    Up    = ImGuiDir_Up,
+    Down  = ImGuiDir_Down,
+  };
+
+  inline bool ArrowButton(const char* str_id, Dir dir) {
+    return ImGui::ArrowButton(str_id, static_cast<ImGuiDir>(dir));
+  }
+
+  // ----------------------------------------
+  // ColorEditorFlags
+
+  /// ImGuiColorEditFlags
+  enum class ColorEditFlags : int {
+    None           = ImGuiColorEditFlags_None,
+    NoAlpha        = ImGuiColorEditFlags_NoAlpha,
+    NoPicker       = ImGuiColorEditFlags_NoPicker,
+    NoOptions      = ImGuiColorEditFlags_NoOptions,
+    NoSmallPreview = ImGuiColorEditFlags_NoSmallPreview,
+    NoInputs       = ImGuiColorEditFlags_NoInputs,
+    NoTooltip      = ImGuiColorEditFlags_NoTooltip,
+    NoLabel        = ImGuiColorEditFlags_NoLabel,
+    NoSidePreview  = ImGuiColorEditFlags_NoSidePreview,
+    NoDragDrop     = ImGuiColorEditFlags_NoDragDrop,
+
+    AlphaBar         = ImGuiColorEditFlags_AlphaBar,
+    AlphaPreview     = ImGuiColorEditFlags_AlphaPreview,
+    AlphaPreviewHalf = ImGuiColorEditFlags_AlphaPreviewHalf,
+    HDR              = ImGuiColorEditFlags_HDR,
+    RGB              = ImGuiColorEditFlags_RGB,
+    HSV              = ImGuiColorEditFlags_HSV,
+    HEX              = ImGuiColorEditFlags_HEX,
+    Uint8            = ImGuiColorEditFlags_Uint8,
+    Float            = ImGuiColorEditFlags_Float,
+    PickerHueBar     = ImGuiColorEditFlags_PickerHueBar,
+    PickerHueWheel   = ImGuiColorEditFlags_PickerHueWheel,
+  };
+
+  template <>
+  struct ec_detail::is_enum_flag<ColorEditFlags> : std::true_type {};
+
+  namespace ec_detail {
+    /// false when flags contradict each other
+    constexpr bool check_color_edit_flags(ColorEditFlags flags) {
+      // at most one display mode, data type and picker type
+      return !has_many(
+               flags,
+               ColorEditFlags::RGB | ColorEditFlags::HSV |
+                 ColorEditFlags::HEX) &&
+             !has_many(flags, ColorEditFlags::Uint8 | ColorEditFlags::Float) &&
+             !has_many(
+               flags,
+               ColorEditFlags::PickerHueBar | ColorEditFlags::PickerHueWheel) &&
+             !(has_any(flags, ColorEditFlags::NoAlpha) &&
+               has_any(
+                 flags,
+                 ColorEditFlags::AlphaBar | ColorEditFlags::AlphaPreview |
+                   ColorEditFlags::AlphaPreviewHalf));
+    }
+  } // namespace ec_detail
+
+  inline bool ColorEdit3(
+    const char* label, float col[3], ColorEditFlags flags) {
+    IMGUI_EC_HOOK("ColorEdit3");
+    IMGUI_EC_CHECK_FLAGS(ec_detail::check_color_edit_flags(flags));
+    return ImGui::ColorEdit3(
+      label, col, static_cast<ImGuiColorEditFlags>(flags));
+  }
+  inline bool ColorEdit4(
+    const char* label, float col[4], ColorEditFlags flags) {
+    IMGUI_EC_HOOK("ColorEdit4");
+    IMGUI_EC_CHECK_FLAGS(ec_detail::check_color_edit_flags(flags));
+    return ImGui::ColorEdit4(
+      label, col, static_cast<ImGuiColorEditFlags>(flags));
+  }
+  inline bool ColorPicker3(
+    const char* label, float col[3], ColorEditFlags flags) {
+    IMGUI_EC_CHECK_FLAGS(ec_detail::check_color_edit_flags(flags));
+    return ImGui::ColorPicker3(
+      label, col, static_cast<ImGuiColorEditFlags>(flags));
+  }
+  inline bool ColorPicker4(
+    const char* label,
+    float col[4],
+    ColorEditFlags flags,
+    const float* ref_col = NULL) {
+    IMGUI_EC_CHECK_FLAGS(ec_detail::check_color_edit_flags(flags));
+    return ImGui::ColorPicker4(
+      label, col, static_cast<ImGuiColorEditFlags>(flags), ref_col);
+  }
+  inline bool ColorButton(
+    const char* desc_id,
+    const ImVec4& col,
+    ColorEditFlags flags,
+    ImVec2 size = ImVec2(0, 0)) {
+    return ImGui::ColorButton(
+      desc_id, col, static_cast<ImGuiColorEditFlags>(flags), size);
+  }
+  inline void SetColorEditOptions(ColorEditFlags flags) {
+    IMGUI_EC_CHECK_FLAGS(ec_detail::check_color_edit_flags(flags));
+    return ImGui::SetColorEditOptions(static_cast<ImGuiColorEditFlags>(flags));
+  }
+
+  // flags as template argument are checked at compile time
+
+  template <ColorEditFlags Flags>
+  inline bool ColorEdit3(const char* label, float col[3]) {
+    IMGUI_EC_HOOK("ColorEdit3");
+    static_assert(
+      ec_detail::check_color_edit_flags(Flags), "conflicting ColorEditFlags");
+    return ImGui::ColorEdit3(
+      label, col, static_cast<ImGuiColorEditFlags>(Flags));
+  }
+  template <ColorEditFlags Flags>
+  inline bool ColorEdit4(const char* label, float col[4]) {
+    IMGUI_EC_HOOK("ColorEdit4");
+    static_assert(
+      ec_detail::check_color_edit_flags(Flags), "conflicting ColorEditFlags");
+    return ImGui::ColorEdit4(
+      label, col, static_cast<ImGuiColorEditFlags>(Flags));
+  }
+
+  // ----------------------------------------
+  // ColumnsFlags
+
+  /// ImGuiColumnsFlags
+  enum class ColumnsFlags : int {
+    // empty?
+  };
+
+  template <>
+  struct ec_detail::is_enum_flag<ColumnsFlags> : std::true_type {};
+
+  // ----------------------------------------
+  // ComboFlags
+
+  /// ImGuiComboFlags
+  enum class ComboFlags : int {
+    None           = ImGuiComboFlags_None,
+    PopupAlignLeft = ImGuiComboFlags_PopupAlignLeft,
+    HeightSmall    = ImGuiComboFlags_HeightSmall,
+    HeightRegular  = ImGuiComboFlags_HeightRegular,
+    HeightLarge    = ImGuiComboFlags_HeightLarge,
+    HeightLargest  = ImGuiComboFlags_HeightLargest,
+    NoArrowButton  = ImGuiComboFlags_NoArrowButton,
+    NoPreview      = ImGuiComboFlags_NoPreview,
+    HeightMask_    = ImGuiComboFlags_HeightMask_, 
+  };
+
+  template <>
+  struct ec_detail::is_enum_flag<ComboFlags> : std::true_type {};
+
+  inline bool BeginCombo(
+    const char* label, const char* preview_value, ComboFlags flags) {
+    IMGUI_EC_HOOK("BeginCombo");
+    return ImGui::BeginCombo(
+      label, preview_value, static_cast<ImGuiComboFlags>(flags));
+  }
+
+  // ----------------------------------------
+  // DragDropFlags
+
+  /// ImGuiDragDropFlags
+  enum class DragDropFlags : int {
+    // clang-format off
+    None                     = ImGuiDragDropFlags_None,
+    // BeginDragDropSource() flags,
+    SourceNoPreviewTooltip   = ImGuiDragDropFlags_SourceNoPreviewTooltip,
+    SourceNoDisableHover     = ImGuiDragDropFlags_SourceNoDisableHover,
+    SourceNoHoldToOpenOthers = ImGuiDragDropFlags_SourceNoHoldToOpenOthers,
+    SourceAllowNullID        = ImGuiDragDropFlags_SourceAllowNullID,
+    SourceExtern             = ImGuiDragDropFlags_SourceExtern,
+    SourceAutoExpirePayload  = ImGuiDragDropFlags_SourceAutoExpirePayload,
+     // AcceptDragDropPayload() flags,
+    AcceptBeforeDelivery     = ImGuiDragDropFlags_AcceptBeforeDelivery,
+    AcceptNoDrawDefaultRect  = ImGuiDragDropFlags_AcceptNoDrawDefaultRect,
+    AcceptNoPreviewTooltip   = ImGuiDragDropFlags_AcceptNoPreviewTooltip,
+    AcceptPeekOnly           = ImGuiDragDropFlags_AcceptPeekOnly,
+    // clang-format on
+  };
+
+  template <>
+  struct ec_detail::is_enum_flag<DragDropFlags> : std::true_type {};
+
+  inline bool BeginDragDropSource(DragDropFlags flags) {
+    return ImGui::BeginDragDropSource(static_cast<ImGuiDragDropFlags>(flags));
+  }
+  inline const ImGuiPayload* AcceptDragDropPayload(
+    const char* type, DragDropFlags flags) {
+    return ImGui::AcceptDragDropPayload(
+      type, static_cast<ImGuiDragDropFlags>(flags));
+  }
+
+  // ----------------------------------------
+  // SelectableFlags
+
+  /// ImGuiSelectableFlags
+  enum class SelectableFlags : int {
+    None             = ImGuiSelectableFlags_None,
+    DontClosePopups  = ImGuiSelectableFlags_DontClosePopups,
+    SpanAllColumns   = ImGuiSelectableFlags_SpanAllColumns,
+    AllowDoubleClick = ImGuiSelectableFlags_AllowDoubleClick,
+    Disabled         = ImGuiSelectableFlags_Disabled,
+  };
+
+  template <>
+  struct ec_detail::is_enum_flag<SelectableFlags> : std::true_type {};
+
+  inline bool Selectable(
+    const char* label,
+    bool selected,
+    SelectableFlags flags,
+    const ImVec2& size = ImVec2(0, 0)) {
+    IMGUI_EC_HOOK("Selectable");
+    return ImGui::Selectable(
+      label, selected, static_cast<ImGuiSelectableFlags>(flags), size);
+  }
+  inline bool Selectable(
+    const char* label,
+    bool* p_selected,
+    SelectableFlags flags,
+    const ImVec2& size = ImVec2(0, 0)) {
+    IMGUI_EC_HOOK("Selectable");
+    return ImGui::Selectable(
+      label, p_selected, static_cast<ImGuiSelectableFlags>(flags), size);
+  }
+
+  // ----------------------------------------
+  // TreeNodeFlags
+
+  /// ImGuiTreeNodeFlags
+  enum class TreeNodeFlags : int {
+    None              = ImGuiTreeNodeFlags_None,
+    Selected          = ImGuiTreeNodeFlags_Selected,
+    Framed            = ImGuiTreeNodeFlags_Framed,
+    AllowItemOverlap  = ImGuiTreeNodeFlags_AllowItemOverlap,
+    NoTreePushOnOpen  = ImGuiTreeNodeFlags_NoTreePushOnOpen,
+    NoAutoOpenOnLog   = ImGuiTreeNodeFlags_NoAutoOpenOnLog,
+    DefaultOpen       = ImGuiTreeNodeFlags_DefaultOpen,
+    OpenOnDoubleClick = ImGuiTreeNodeFlags_OpenOnDoubleClick,
+    OpenOnArrow       = ImGuiTreeNodeFlags_OpenOnArrow,
+    Leaf              = ImGuiTreeNodeFlags_Leaf,
+    Bullet            = ImGuiTreeNodeFlags_Bullet,
+    FramePadding      = ImGuiTreeNodeFlags_FramePadding,
+    // SpanAllAvailWidth    = ImGuITreeNodeFlags_SpanAllAvailWidth,
+    // NoScrollOnOpen       = ImGuiTreeNodeFlags_NoScrollOnOpen,
+    NavLeftJumpsBackHere = ImGuiTreeNodeFlags_NavLeftJumpsBackHere,
+    CollapsingHeader     = ImGuiTreeNodeFlags_CollapsingHeader,
+  };
+
+  template <>
+  struct ec_detail::is_enum_flag<TreeNodeFlags> : std::true_type {};
+
+  namespace ec_detail {
+    /// false when flags contradict each other
+    constexpr bool check_tree_node_flags(TreeNodeFlags flags) {
+      // leaf nodes never open
+      return !(
+        has_any(flags, TreeNodeFlags::Leaf) &&
+        has_any(
+          flags,
+          TreeNodeFlags::OpenOnArrow | TreeNodeFlags::OpenOnDoubleClick));
+    }
+
+    /// decimal digits of v, written backwards from end
+    inline char* format_int_backwards(char* end, int v) {
+      unsigned int u = v < 0 ? 0u - static_cast<unsigned int>(v)
+                             : static_cast<unsigned int>(v);
+      do {
+        *--end = static_cast<char>('0' + u % 10);
+        u /= 10;
+      } while (u != 0);
+      if (v < 0)
+        *--end = '-';
+      return end;
+    }
+
+    /// Label of a format without arguments. False when fmt needs printf.
+    inline bool trivial_label(
+      char (&)[16],
+      const char*& label,
+      const char*& label_end,
+      const char* fmt) {
+      if (strchr(fmt, '%'))
+        return false;
+      label     = fmt;
+      label_end = fmt + strlen(fmt);
+      return true;
+    }
+    /// Label of "%s" with a string or "%d" with an integer, formatted without
+    /// printf. False for other formats.
+    template <class T>
+    bool trivial_label(
+      char (&buf)[16],
+      const char*& label,
+      const char*& label_end,
+      const char* fmt,
+      const T& arg) {
+      if (fmt[0] != '%' || fmt[1] == '\0' || fmt[2] != '\0')
+        return false;
+      if constexpr (std::is_convertible_v<const T&, const char*>) {
+        const char* str = arg;
+        if (fmt[1] != 's' || !str)
+          return false;
+        label     = str;
+        label_end = str + strlen(str);
+        return true;
+      } else if constexpr (
+        std::is_integral_v<T> && sizeof(T) <= sizeof(int)) {
+        if (fmt[1] != 'd')
+          return false;
+        label_end = buf + sizeof(buf);
+        label     = format_int_backwards(buf + sizeof(buf), int(arg));
+        return true;
+      } else {
+        return false;
+      }
+    }
+    /// two or more arguments always need printf
+    template <class T, class U, class... Rest>
+    bool trivial_label(
+      char (&)[16],
+      const char*&,
+      const char*&,
+      const char*,
+      const T&,
+      const U&,
+      const Rest&...) {
+      return false;
+    }
+  } // namespace ec_detail
+
+  // declared in imgui_internal.h; used to submit labels which need no
+  // formatting without going through the printf path of TreeNodeEx()
+  IMGUI_API bool TreeNodeBehavior(
+    ImGuiID id,
+    ImGuiTreeNodeFlags flags,
+    const char* label,
+    const char* label_end);
+
+  inline bool TreeNodeEx(const char* label, TreeNodeFlags flags) {
+    IMGUI_EC_HOOK("TreeNodeEx");
+    IMGUI_EC_CHECK_FLAGS(ec_detail::check_tree_node_flags(flags));
+    return ImGui::TreeNodeEx(label, static_cast<ImGuiTreeNodeFlags>(flags));
+  }
+
+  // A format without arguments, "%s" or "%d" skips printf formatting.
+
+  template <class... Args>
+  inline bool TreeNodeEx(
+    const char* str_id, TreeNodeFlags flags, const char* fmt, Args&&... args) {
+    IMGUI_EC_HOOK("TreeNodeEx");
+    IMGUI_EC_CHECK_FLAGS(ec_detail::check_tree_node_flags(flags));
+    char buf[16];
+    const char* label;
+    const char* label_end;
+    if (ec_detail::trivial_label(buf, label, label_end, fmt, args...))
+      return ImGui::TreeNodeBehavior(
+        ImGui::GetID(str_id), static_cast<ImGuiTreeNodeFlags>(flags), label,
+        label_end);
+    return ImGui::TreeNodeEx(
+      str_id, static_cast<ImGuiTreeNodeFlags>(flags), fmt,
+      std::forward<Args>(args)...);
+  }
+  template <class... Args>
+  inline bool TreeNodeEx(
+    const void* ptr_id, TreeNodeFlags flags, const char* fmt, Args&&... args) {
+    IMGUI_EC_HOOK("TreeNodeEx");
+    IMGUI_EC_CHECK_FLAGS(ec_detail::check_tree_node_flags(flags));
+    char buf[16];
+    const char* label;
+    const char* label_end;
+    if (ec_detail::trivial_label(buf, label, label_end, fmt, args...))
+      return ImGui::TreeNodeBehavior(
+        ImGui::GetID(ptr_id), static_cast<ImGuiTreeNodeFlags>(flags), label,
+        label_end);
+    return ImGui::TreeNodeEx(
+      ptr_id, static_cast<ImGuiTreeNodeFlags>(flags), fmt,
+      std::forward<Args>(args)...);
+  }
+  inline bool TreeNodeExV(
+    const char* str_id, TreeNodeFlags flags, const char* fmt, va_list args) {
+    return ImGui::TreeNodeExV(
+      str_id, static_cast<ImGuiTreeNodeFlags>(flags), fmt, args);
+  }
+  inline bool TreeNodeExV(
+    const void* ptr_id, TreeNodeFlags flags, const char* fmt, va_list args) {
+    return ImGui::TreeNodeExV(
+      ptr_id, static_cast<ImGuiTreeNodeFlags>(flags), fmt, args);
+  }
+  inline bool CollapsingHeader(const char* label, TreeNodeFlags flags) {
+    IMGUI_EC_HOOK("CollapsingHeader");
+    return ImGui::CollapsingHeader(
+      label, static_cast<ImGuiTreeNodeFlags>(flags));
+  }
+  inline bool CollapsingHeader(
+    const char* label, bool* p_open, TreeNodeFlags flags) {
+    IMGUI_EC_HOOK("CollapsingHeader");
+    return ImGui::CollapsingHeader(
+      label, p_open, static_cast<ImGuiTreeNodeFlags>(flags));
+  }
+
+  // flags as template argument are checked at compile time
+
+  template <TreeNodeFlags Flags>
+  inline bool TreeNodeEx(const char* label) {
+    IMGUI_EC_HOOK("TreeNodeEx");
+    static_assert(
+      ec_detail::check_tree_node_flags(Flags), "conflicting TreeNodeFlags");
+    return ImGui::TreeNodeEx(label, static_cast<ImGuiTreeNodeFlags>(Flags));
+  }
+
+} // namespace ImGui
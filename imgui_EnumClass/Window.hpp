@@ -0,0 +1,223 @@
+#pragma once
+
+#include "Flags.hpp"
+
+namespace ImGui {
+
+  // ----------------------------------------
+  // Cond
+
+  /// ImGuiCond
+  enum class Cond : int {
+    Always       = ImGuiCond_Always,
+    Once         = ImGuiCond_Once,
+    FirstUseEver = ImGuiCond_FirstUseEver,
+    Appearing    = ImGuiCond_Appearing,
+  };
+
+  inline void SetNextWindowPos(
+    const ImVec2& pos, Cond cond, const ImVec2& pivot = ImVec2(0, 0)) {
+    return ImGui::SetNextWindowPos(pos, static_cast<ImGuiCond>(cond), pivot);
+  }
+  inline void SetNextWindowSize(const ImVec2& size, Cond cond) {
+    return ImGui::SetNextWindowSize(size, static_cast<ImGuiCond>(cond));
+  }
+  inline void SetNextWindowCollapsed(bool collapsed, Cond cond) {
+    return ImGui::SetNextWindowCollapsed(
+      collapsed, static_cast<ImGuiCond>(cond));
+  }
+  inline void SetWindowPos(const ImVec2& pos, Cond cond) {
+    return ImGui::SetWindowPos(pos, static_cast<ImGuiCond>(cond));
+  }
+  inline void SetWindowSize(const ImVec2& size, Cond cond) {
+    return ImGui::SetWindowSize(size, static_cast<ImGuiCond>(cond));
+  }
+  inline void SetWindowCollapsed(bool collapsed, Cond cond) {
+    return ImGui::SetWindowCollapsed(collapsed, static_cast<ImGuiCond>(cond));
+  }
+  inline void SetWindowPos(const char* name, const ImVec2& pos, Cond cond) {
+    return ImGui::SetWindowPos(name, pos, static_cast<ImGuiCond>(cond));
+  }
+  inline void SetWindowSize(const char* name, const ImVec2& size, Cond cond) {
+    return ImGui::SetWindowSize(name, size, static_cast<ImGuiCond>(cond));
+  }
+  inline void SetWindowCollapsed(const char* name, bool collapsed, Cond cond) {
+    return ImGui::SetWindowCollapsed(
+      name, collapsed, static_cast<ImGuiCond>(cond));
+  }
+
+  // ----------------------------------------
+  // FocusedFlags
+
+  /// ImGuiFocusedFlags
+  enum class FocusedFlags : int {
+    None                = ImGuiFocusedFlags_None,
+    ChildWindows        = ImGuiFocusedFlags_ChildWindows,
+    RootWindow          = ImGuiFocusedFlags_RootWindow,
+    AnyWindow           = ImGuiFocusedFlags_AnyWindow,
+    RootAndChildWindows = ImGuiFocusedFlags_RootAndChildWindows,
+  };
+
+  template <>
+  struct ec_detail::is_enum_flag<FocusedFlags> : std::true_type {};
+
+  inline bool IsWindowFocused(FocusedFlags flags) {
+    IMGUI_EC_HOOK("IsWindowFocused");
+    return ImGui::IsWindowFocused(static_cast<ImGuiFocusedFlags>(flags));
+  }
+
+  // ----------------------------------------
+  // HoverredFlags
+
+  /// ImGuiHoverredFlags
+  enum class HoveredFlags : int {
+  // clang-format off
+    None                         = ImGuiHoveredFlags_None,
+    ChildWindows                 = ImGuiHoveredFlags_ChildWindows,
+    RootWindow                   = ImGuiHoveredFlags_RootWindow,
+    AnyWindow                    = ImGuiHoveredFlags_AnyWindow,
+    AllowWhenBlockedByPopup      = ImGuiHoveredFlags_AllowWhenBlockedByPopup,
+    // AllowWhenBlockedByModel      = ImGuiHoveredFlags_AllowWhenBlockedByModal,
+    AllowWhenBlockedByActiveItem = ImGuiHoveredFlags_AllowWhenBlockedByActiveItem,
+    AllowWhenOverlapped          = ImGuiHoveredFlags_AllowWhenOverlapped,
+    AllowWhenDisabled            = ImGuiHoveredFlags_AllowWhenDisabled,
+    RectOnly                     = ImGuiHoveredFlags_RectOnly,
+    RootAndChildWindows          = ImGuiHoveredFlags_RootAndChildWindows,
+  // clang-format on
+  };
+
+  template <>
+  struct ec_detail::is_enum_flag<HoveredFlags> : std::true_type {};
+
+  inline bool IsWindowHovered(HoveredFlags flags) {
+    IMGUI_EC_HOOK("IsWindowHovered");
+    return ImGui::IsWindowHovered(static_cast<ImGuiHoveredFlags>(flags));
+  }
+  inline bool IsItemHovered(HoveredFlags flags) {
+    IMGUI_EC_HOOK("IsItemHovered");
+    return ImGui::IsItemHovered(static_cast<ImGuiHoveredFlags>(flags));
+  }
+
+  // ----------------------------------------
+  // WindowFlags
+
+  /// ImGuiWindowFlags
+  enum class WindowFlags : int {
+    None                      = ImGuiWindowFlags_None,
+    NoTitleBar                = ImGuiWindowFlags_NoTitleBar,
+    NoResize                  = ImGuiWindowFlags_NoResize,
+    NoMove                    = ImGuiWindowFlags_NoMove,
+    NoScrollbar               = ImGuiWindowFlags_NoScrollbar,
+    NoScrollWithMouse         = ImGuiWindowFlags_NoScrollWithMouse,
+    NoCollapse                = ImGuiWindowFlags_NoCollapse,
+    AlwaysAutoReize           = ImGuiWindowFlags_AlwaysAutoResize,
+    NoBackground              = ImGuiWindowFlags_NoBackground,
+    NoSavedSettings           = ImGuiWindowFlags_NoSavedSettings,
+    NoMouseInputs             = ImGuiWindowFlags_NoMouseInputs,
+    MenuBar                   = ImGuiWindowFlags_MenuBar,
+    HorizontalScrollbar       = ImGuiWindowFlags_HorizontalScrollbar,
+    NoFocusOnAppearing        = ImGuiWindowFlags_NoFocusOnAppearing,
+    NoBringToFrontOnFocus     = ImGuiWindowFlags_NoBringToFrontOnFocus,
+    AlwaysVerticalScrollbar   = ImGuiWindowFlags_AlwaysVerticalScrollbar,
+    AlwaysHorizontalScrollbar = ImGuiWindowFlags_AlwaysHorizontalScrollbar,
+    AlwaysUseWindowPadding    = ImGuiWindowFlags_AlwaysUseWindowPadding,
+    NoNavInputs               = ImGuiWindowFlags_NoNavInputs,
+    NoNavFocus                = ImGuiWindowFlags_NoNavFocus,
+    NoNav                     = ImGuiWindowFlags_NoNav,
+    NoDecoration              = ImGuiWindowFlags_NoDecoration,
+    NoInputs                  = ImGuiWindowFlags_NoInputs,
+  };
+
+  template <>
+  struct ec_detail::is_enum_flag<WindowFlags> : std::true_type {};
+
+  namespace ec_detail {
+    /// false when flags contradict each other
+    constexpr bool check_window_flags(WindowFlags flags) {
+      // NoScrollbar turns off the scrollbar HorizontalScrollbar allows.
+      // Always*Scrollbar override NoScrollbar, so they are no conflict.
+      return !(
+        has_any(flags, WindowFlags::NoScrollbar) &&
+        has_any(flags, WindowFlags::HorizontalScrollbar));
+    }
+    /// false when flags contradict each other or the child size
+    constexpr bool check_child_flags(WindowFlags flags, float w, float h) {
+      // fixed size child can't be auto resized
+      return check_window_flags(flags) &&
+             !(has_any(flags, WindowFlags::AlwaysAutoReize) &&
+               (w != 0.0f || h != 0.0f));
+    }
+  } // namespace ec_detail
+
+  inline bool Begin(const char* name, bool* p_open, WindowFlags flags) {
+    IMGUI_EC_HOOK("Begin");
+    IMGUI_EC_CHECK_FLAGS(ec_detail::check_window_flags(flags));
+    return ImGui::Begin(name, p_open, static_cast<ImGuiWindowFlags>(flags));
+  }
+  inline bool BeginChild(
+    const char* str_id, const ImVec2& size, bool border, WindowFlags flags) {
+    IMGUI_EC_HOOK("BeginChild");
+    IMGUI_EC_CHECK_FLAGS(ec_detail::check_child_flags(flags, size.x, size.y));
+    return ImGui::BeginChild(
+      str_id, size, border, static_cast<ImGuiWindowFlags>(flags));
+  }
+  inline bool BeginChild(
+    ImGuiID id, const ImVec2& size, bool border, WindowFlags flags) {
+    IMGUI_EC_HOOK("BeginChild");
+    IMGUI_EC_CHECK_FLAGS(ec_detail::check_child_flags(flags, size.x, size.y));
+    return ImGui::BeginChild(
+      id, size, border, static_cast<ImGuiWindowFlags>(flags));
+  }
+  inline bool BeginPopup(const char* str_id, WindowFlags flags) {
+    IMGUI_EC_HOOK("BeginPopup");
+    IMGUI_EC_CHECK_FLAGS(ec_detail::check_window_flags(flags));
+    return ImGui::BeginPopup(str_id, static_cast<ImGuiWindowFlags>(flags));
+  }
+  inline bool BeginPopupModal(
+    const char* name, bool* p_open, WindowFlags flags) {
+    IMGUI_EC_HOOK("BeginPopupModal");
+    IMGUI_EC_CHECK_FLAGS(ec_detail::check_window_flags(flags));
+    return ImGui::BeginPopupModal(
+      name, p_open, static_cast<ImGuiWindowFlags>(flags));
+  }
+  inline bool BeginChildFrame(
+    ImGuiID id, const ImVec2& size, WindowFlags flags) {
+    IMGUI_EC_HOOK("BeginChildFrame");
+    IMGUI_EC_CHECK_FLAGS(ec_detail::check_child_flags(flags, size.x, size.y));
+    return ImGui::BeginChildFrame(
+      id, size, static_cast<ImGuiWindowFlags>(flags));
+  }
+
+  // flags as template argument are checked at compile time
+
+  template <WindowFlags Flags>
+  inline bool Begin(const char* name, bool* p_open = NULL) {
+    IMGUI_EC_HOOK("Begin");
+    static_assert(
+      ec_detail::check_window_flags(Flags), "conflicting WindowFlags");
+    return ImGui::Begin(name, p_open, static_cast<ImGuiWindowFlags>(Flags));
+  }
+  template <WindowFlags Flags>
+  inline bool BeginChild(
+    const char* str_id,
+    const ImVec2& size = ImVec2(0, 0),
+    bool border        = false) {
+    IMGUI_EC_HOOK("BeginChild");
+    static_assert(
+      ec_detail::check_window_flags(Flags), "conflicting WindowFlags");
+    IMGUI_EC_CHECK_FLAGS(ec_detail::check_child_flags(Flags, size.x, size.y));
+    return ImGui::BeginChild(
+      str_id, size, border, static_cast<ImGuiWindowFlags>(Flags));
+  }
+  template <WindowFlags Flags>
+  inline bool BeginChild(
+    ImGuiID id, const ImVec2& size = ImVec2(0, 0), bool border = false) {
+    IMGUI_EC_HOOK("BeginChild");
+    static_assert(
+      ec_detail::check_window_flags(Flags), "conflicting WindowFlags");
+    IMGUI_EC_CHECK_FLAGS(ec_detail::check_child_flags(Flags, size.x, size.y));
+    return ImGui::BeginChild(
+      id, size, border, static_cast<ImGuiWindowFlags>(Flags));
+  }
+
+} // namespace ImGui
@@ -0,0 +1,68 @@
+# Compiles wrappers.cpp to assembly and checks that every ec_<name> has the
+# same instructions as raw_<name>, and ends in a jump (a tail call).
+#   cmake -DCOMPILER=<c++> -DFLAGS=<flags> -DINCLUDE_DIRS=<dir|dir>
+#         -DSOURCE=wrappers.cpp -DOUTPUT=wrappers.s -P compare_asm.cmake
+
+separate_arguments(FLAGS)
+string(REPLACE "|" ";" INCLUDE_DIRS "${INCLUDE_DIRS}")
+set(include_flags)
+foreach(dir IN LISTS INCLUDE_DIRS)
+  list(APPEND include_flags "-I${dir}")
+endforeach()
+
+execute_process(
+  COMMAND ${COMPILER} ${FLAGS} ${include_flags} -O2 -S -w
+    -fno-asynchronous-unwind-tables ${SOURCE} -o ${OUTPUT}
+  RESULT_VARIABLE result ERROR_VARIABLE error)
+if(NOT result EQUAL 0)
+  message(FATAL_ERROR "${SOURCE} failed to compile:\n${error}")
+endif()
+
+# instructions of each ec_/raw_ function, with local labels renamed
+file(STRINGS ${OUTPUT} lines)
+set(names)
+set(current)
+foreach(line IN LISTS lines)
+  if(line MATCHES "^_?((ec|raw)_[A-Za-z0-9_]+):")
+    set(current ${CMAKE_MATCH_1})
+    set(body_${current})
+    if(CMAKE_MATCH_2 STREQUAL "ec")
+      string(REGEX REPLACE "^ec_" "" name ${current})
+      list(APPEND names ${name})
+    endif()
+  elseif(NOT current OR line MATCHES "^[ \t]*\\.(size|cfi_endproc)")
+    set(current)
+  elseif(NOT line MATCHES "^[ \t]*([.#@;]|//|$)" AND NOT line MATCHES "^[^ \t]+:")
+    string(STRIP "${line}" line)
+    string(REGEX REPLACE "[ \t]+" " " line "${line}")
+    string(REGEX REPLACE "(^|[^A-Za-z0-9_])\\.?L[A-Za-z_]*[0-9][A-Za-z0-9_$]*"
+      "\\1L" line "${line}")
+    list(APPEND body_${current} "${line}")
+  endif()
+endforeach()
+
+list(LENGTH names count)
+if(count EQUAL 0)
+  message(FATAL_ERROR "no ec_ function found in ${OUTPUT}")
+endif()
+
+set(failures)
+foreach(name IN LISTS names)
+  if(NOT body_ec_${name} STREQUAL body_raw_${name})
+    string(REPLACE ";" "\n    " ec "${body_ec_${name}}")
+    string(REPLACE ";" "\n    " raw "${body_raw_${name}}")
+    list(APPEND failures
+      "${name}: wrapper differs from the raw call\n  ec_${name}:\n    ${ec}\n  raw_${name}:\n    ${raw}")
+    continue()
+  endif()
+  list(GET body_ec_${name} -1 last)
+  if(NOT last MATCHES "^(jmp|b|br)[ \t]")
+    list(APPEND failures "${name}: not a tail call, ends with '${last}'")
+  endif()
+endforeach()
+
+if(failures)
+  string(REPLACE ";" "\n" failures "${failures}")
+  message(FATAL_ERROR "${failures}")
+endif()
+message("${count} wrappers are direct tail calls")
@@ -0,0 +1,126 @@
+// Each ec_<name> calls a typed wrapper and raw_<name> the ImGui function it
+// wraps, with the same arguments. compare_asm.cmake compiles this file with
+// -O2 -S and checks that both bodies are the same instructions, i.e. that
+// the wrapper is folded into a direct (tail) call. ImGui is only declared.
+
+#include <imgui_EnumClass.hpp>
+
+#define EC_CODEGEN(name, params, wrapper, raw)                                 \
+  extern "C" decltype(auto) ec_##name params {                                 \
+    return wrapper;                                                            \
+  }                                                                            \
+  extern "C" decltype(auto) raw_##name params {                                \
+    return raw;                                                                \
+  }
+
+using namespace ImGui;
+
+// Window.hpp
+EC_CODEGEN(
+  Begin, (const char* name, bool* p_open, int flags),
+  Begin(name, p_open, static_cast<WindowFlags>(flags)),
+  Begin(name, p_open, flags))
+EC_CODEGEN(
+  BeginChild, (const char* id, const ImVec2& size, bool border, int flags),
+  BeginChild(id, size, border, static_cast<WindowFlags>(flags)),
+  BeginChild(id, size, border, flags))
+EC_CODEGEN(
+  BeginPopup, (const char* id, int flags),
+  BeginPopup(id, static_cast<WindowFlags>(flags)), BeginPopup(id, flags))
+EC_CODEGEN(
+  SetNextWindowSize, (const ImVec2& size, int cond),
+  SetNextWindowSize(size, static_cast<Cond>(cond)),
+  SetNextWindowSize(size, cond))
+EC_CODEGEN(
+  IsWindowFocused, (int flags),
+  IsWindowFocused(static_cast<FocusedFlags>(flags)), IsWindowFocused(flags))
+EC_CODEGEN(
+  IsWindowHovered, (int flags),
+  IsWindowHovered(static_cast<HoveredFlags>(flags)), IsWindowHovered(flags))
+EC_CODEGEN(
+  IsItemHovered, (int flags),
+  IsItemHovered(static_cast<HoveredFlags>(flags)), IsItemHovered(flags))
+
+// Style.hpp
+EC_CODEGEN(
+  PushStyleColorU32, (int idx, ImU32 col),
+  PushStyleColor(static_cast<Col>(idx), col), PushStyleColor(idx, col))
+EC_CODEGEN(
+  PushStyleColorVec4, (int idx, const ImVec4& col),
+  PushStyleColor(static_cast<Col>(idx), col), PushStyleColor(idx, col))
+EC_CODEGEN(
+  PushStyleVarFloat, (int idx, float val),
+  PushStyleVar(static_cast<StyleVar>(idx), val), PushStyleVar(idx, val))
+EC_CODEGEN(
+  PushStyleVarVec2, (int idx, const ImVec2& val),
+  PushStyleVar(static_cast<StyleVar>(idx), val), PushStyleVar(idx, val))
+EC_CODEGEN(
+  GetColorU32, (int idx, float alpha_mul),
+  GetColorU32(static_cast<Col>(idx), alpha_mul), GetColorU32(idx, alpha_mul))
+EC_CODEGEN(
+  GetStyleColorVec4, (int idx), GetStyleColorVec4(static_cast<Col>(idx)),
+  GetStyleColorVec4(idx))
+
+// Input.hpp
+EC_CODEGEN(
+  GetKeyIndex, (int key), GetKeyIndex(static_cast<Key>(key)),
+  GetKeyIndex(key))
+EC_CODEGEN(
+  SetMouseCursor, (int cursor),
+  SetMouseCursor(static_cast<MouseCursor>(cursor)), SetMouseCursor(cursor))
+EC_CODEGEN(
+  InputText, (const char* label, char* buf, size_t size, int flags),
+  InputText(label, buf, size, static_cast<InputTextFlags>(flags)),
+  InputText(label, buf, size, flags))
+EC_CODEGEN(
+  DragScalar,
+  (const char* label, int type, void* v, float speed, const void* min,
+   const void* max),
+  DragScalar(label, static_cast<DataType>(type), v, speed, min, max),
+  DragScalar(label, type, v, speed, min, max))
+
+// DrawList.hpp
+EC_CODEGEN(
+  AddRect,
+  (ImDrawList* draw_list, const ImVec2& a, const ImVec2& b, ImU32 col,
+   float rounding, int corners),
+  AddRect(
+    draw_list, a, b, col, rounding, static_cast<DrawCornerFlags>(corners)),
+  draw_list->AddRect(a, b, col, rounding, corners))
+EC_CODEGEN(
+  AddRectFilled,
+  (ImDrawList* draw_list, const ImVec2& a, const ImVec2& b, ImU32 col,
+   float rounding, int corners),
+  AddRectFilled(
+    draw_list, a, b, col, rounding, static_cast<DrawCornerFlags>(corners)),
+  draw_list->AddRectFilled(a, b, col, rounding, corners))
+
+// Widgets.hpp
+EC_CODEGEN(
+  ArrowButton, (const char* id, int dir),
+  ArrowButton(id, static_cast<Dir>(dir)), ArrowButton(id, dir))
+EC_CODEGEN(
+  ColorEdit4, (const char* label, float* col, int flags),
+  ColorEdit4(label, col, static_cast<ColorEditFlags>(flags)),
+  ColorEdit4(label, col, flags))
+EC_CODEGEN(
+  BeginCombo, (const char* label, const char* preview, int flags),
+  BeginCombo(label, preview, static_cast<ComboFlags>(flags)),
+  BeginCombo(label, preview, flags))
+EC_CODEGEN(
+  Selectable,
+  (const char* label, bool selected, int flags, const ImVec2& size),
+  Selectable(label, selected, static_cast<SelectableFlags>(flags), size),
+  Selectable(label, selected, flags, size))
+EC_CODEGEN(
+  TreeNodeEx, (const char* label, int flags),
+  TreeNodeEx(label, static_cast<TreeNodeFlags>(flags)),
+  TreeNodeEx(label, flags))
+EC_CODEGEN(
+  TreeNodeExFormat, (const void* id, int flags, int a, const char* b),
+  TreeNodeEx(id, static_cast<TreeNodeFlags>(flags), "%d %s", a, b),
+  TreeNodeEx(id, flags, "%d %s", a, b))
+EC_CODEGEN(
+  CollapsingHeader, (const char* label, int flags),
+  CollapsingHeader(label, static_cast<TreeNodeFlags>(flags)),
+  CollapsingHeader(label, flags))
@@ -0,0 +1,80 @@
+// VirtualTree::Draw() on a tree with leaves, with IMGUI_ENUM_CLASS_CHECK_FLAGS
+// defined: no row may submit conflicting TreeNodeFlags, whatever the flags
+// given to Draw(). Runs headless frames, exits non-zero on a failed check.
+
+#include <stdio.h> // fprintf
+
+static int failed_checks = 0;
+
+// count instead of aborting, and check in release builds too
+#define IM_ASSERT(expr)                                                        \
+  ((expr) ? (void)0                                                            \
+          : (void)(++failed_checks,                                            \
+                   fprintf(stderr, "%s:%d: %s\n", __FILE__, __LINE__, #expr)))
+#define IMGUI_ENUM_CLASS_CHECK_FLAGS
+
+#include <imgui_EnumClass.hpp>
+#include <imgui_EnumClass/VirtualList.hpp>
+
+namespace {
+  using ImGui::TreeNodeFlags;
+
+  //  0
+  //    1      leaf
+  //    2
+  //      3    leaf
+  //      4    leaf
+  //  5        leaf
+  const int depth[] = {0, 1, 1, 2, 2, 0};
+  const char* const labels[] = {"0", "1", "2", "3", "4", "5"};
+
+  void frame(ImGui::VirtualTree& tree, TreeNodeFlags flags, int* selected) {
+    ImGui::NewFrame();
+    ImGui::SetNextWindowPos(ImVec2(0, 0), ImGuiCond_Always);
+    ImGui::SetNextWindowSize(ImVec2(400, 300), ImGuiCond_Always);
+    ImGui::Begin("tree");
+    tree.Draw([](int node) { return labels[node]; }, flags, selected);
+    ImGui::End();
+    ImGui::Render();
+  }
+} // namespace
+
+int main() {
+  ImGuiContext* context = ImGui::CreateContext();
+  ImGuiIO& io           = ImGui::GetIO();
+  io.DisplaySize        = ImVec2(400, 300);
+  io.DeltaTime          = 1.0f / 60.0f;
+  io.IniFilename        = NULL;
+  unsigned char* pixels;
+  int width, height;
+  io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+  io.Fonts->TexID = reinterpret_cast<ImTextureID>(1);
+
+  ImGui::VirtualTree tree;
+  tree.SetNodes(depth, IM_ARRAYSIZE(depth));
+  tree.SetOpen(0, true);
+  tree.SetOpen(2, true);
+  int selected = 3;
+
+  const TreeNodeFlags flags[] = {
+    TreeNodeFlags::OpenOnArrow,
+    TreeNodeFlags::OpenOnDoubleClick,
+    TreeNodeFlags::OpenOnArrow | TreeNodeFlags::OpenOnDoubleClick,
+    TreeNodeFlags::None,
+  };
+  for (TreeNodeFlags f : flags)
+    for (int i = 0; i < 3; ++i)
+      frame(tree, f, &selected);
+
+  int status = 0;
+  if (tree.GetRowCount() != 6) {
+    fprintf(stderr, "expected 6 rows, got %d\n", tree.GetRowCount());
+    status = 1;
+  }
+  if (failed_checks != 0) {
+    fprintf(stderr, "%d failed checks\n", failed_checks);
+    status = 1;
+  }
+  ImGui::DestroyContext(context);
+  return status;
+}